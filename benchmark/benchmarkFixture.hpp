@@ -0,0 +1,238 @@
+/**
+ *  \file   benchmarkFixture.hpp
+ *  \brief  The file implements the senders and receivers shared by the benchmarks.
+ */
+
+#ifndef BENCHMARK_FIXTURE_HPP
+#define BENCHMARK_FIXTURE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "bufferPool.hpp"
+#include "signalObject.hpp"
+
+/**
+ *  \struct Payload
+ *  \brief  The struct represents a signal argument of a specific size.
+ *  \tparam Size passes the argument's size in bytes.
+ */
+template<std::size_t Size>
+struct Payload
+{
+    /**
+     *  \var    bytes
+     *  \brief  Content of the argument.
+     */
+    std::array<std::uint8_t, Size> bytes{};
+};
+
+/**
+ *  \struct Tag
+ *  \brief  The struct gives each signal of a benchmark its own signature.
+ *  \tparam Id passes the signature's index.
+ */
+template<std::size_t Id>
+struct Tag
+{};
+
+/**
+ *  \class  Sender
+ *  \brief  The class emits the signals measured by the benchmarks.
+ */
+class Sender : public SignalObject
+{
+public:
+    /**
+     *  \fn         sampled(int value)
+     *  \brief      This signal is emitted for a new sample.
+     *  \param[in]  value passes the sample.
+     */
+    void sampled(int value)
+    {
+        fireAllSlots(this, &Sender::sampled, value);
+    }
+
+    /**
+     *  \fn         tagged(Tag<Id> tag, int value)
+     *  \brief      This signal is emitted with a signature of its own per Id.
+     *  \tparam     Id passes the signature's index.
+     *  \param[in]  tag passes the signature's tag.
+     *  \param[in]  value passes the sample.
+     */
+    template<std::size_t Id>
+    void tagged(Tag<Id> tag, int value)
+    {
+        fireAllSlots(this, &Sender::tagged<Id>, tag, value);
+    }
+
+    /**
+     *  \fn         copied(Payload<Size> payload)
+     *  \brief      This signal is emitted with an argument passed by value.
+     *  \tparam     Size passes the argument's size in bytes.
+     *  \param[in]  payload passes the argument.
+     */
+    template<std::size_t Size>
+    void copied(Payload<Size> payload)
+    {
+        fireAllSlots(this, &Sender::copied<Size>, std::move(payload));
+    }
+
+    /**
+     *  \fn         referenced(const Payload<Size>& payload)
+     *  \brief      This signal is emitted with an argument passed by reference.
+     *  \tparam     Size passes the argument's size in bytes.
+     *  \param[in]  payload passes the argument.
+     */
+    template<std::size_t Size>
+    void referenced(const Payload<Size>& payload)
+    {
+        fireAllSlots(this, &Sender::referenced<Size>, payload);
+    }
+
+    /**
+     *  \fn         shared(SharedBuffer<Payload<Size>> payload)
+     *  \brief      This signal is emitted with an argument inside a pooled buffer.
+     *  \tparam     Size passes the argument's size in bytes.
+     *  \param[in]  payload passes the shared buffer of the argument.
+     */
+    template<std::size_t Size>
+    void shared(SharedBuffer<Payload<Size>> payload)
+    {
+        fireAllSlots(this, &Sender::shared<Size>, std::move(payload));
+    }
+};
+
+/**
+ *  \class  Receiver
+ *  \brief  The class provides the slots called by the benchmarks.
+ */
+class Receiver : public SignalObject
+{
+public:
+    /**
+     *  \fn         onSampled(int value)
+     *  \brief      Accumulates a sample.
+     *  \param[in]  value passes the sample.
+     */
+    void onSampled(int value)
+    {
+        sum = sum + value;
+    }
+
+    /**
+     *  \fn         onTagged(Tag<Id>, int value)
+     *  \brief      Accumulates a tagged sample.
+     *  \tparam     Id passes the signature's index.
+     *  \param[in]  value passes the sample.
+     */
+    template<std::size_t Id>
+    void onTagged(Tag<Id>, int value)
+    {
+        sum = sum + value;
+    }
+
+    /**
+     *  \fn         onCopied(Payload<Size> payload)
+     *  \brief      Reads an argument passed by value.
+     *  \tparam     Size passes the argument's size in bytes.
+     *  \param[in]  payload passes the argument.
+     */
+    template<std::size_t Size>
+    void onCopied(Payload<Size> payload)
+    {
+        sum = sum + payload.bytes[Size - 1];
+    }
+
+    /**
+     *  \fn         onReferenced(const Payload<Size>& payload)
+     *  \brief      Reads an argument passed by reference.
+     *  \tparam     Size passes the argument's size in bytes.
+     *  \param[in]  payload passes the argument.
+     */
+    template<std::size_t Size>
+    void onReferenced(const Payload<Size>& payload)
+    {
+        sum = sum + payload.bytes[Size - 1];
+    }
+
+    /**
+     *  \fn         onShared(SharedBuffer<Payload<Size>> payload)
+     *  \brief      Reads an argument inside a pooled buffer.
+     *  \tparam     Size passes the argument's size in bytes.
+     *  \param[in]  payload passes the shared buffer of the argument.
+     */
+    template<std::size_t Size>
+    void onShared(SharedBuffer<Payload<Size>> payload)
+    {
+        sum = sum + payload->bytes[Size - 1];
+    }
+
+    /**
+     *  \var    sum
+     *  \brief  Accumulated arguments preventing the slots from being optimized away.
+     */
+    volatile int sum = 0;
+};
+
+/**
+ *  \class  Population
+ *  \brief  The class occupies the connection pool of the sampled signal with unrelated senders.
+ *  \note   The connections share the signature of the measured signal but not its sender, so
+ *          they grow the pool without adding slots to the measured emit.
+ */
+class Population
+{
+public:
+    /**
+     *  \fn         Population(std::size_t count, Receiver* receiver)
+     *  \brief      The constructor connects the passed number of unrelated senders.
+     *  \param[in]  count passes the number of connections to add.
+     *  \param[in]  receiver passes a pointer to the receiver of the connections.
+     */
+    Population(std::size_t count, Receiver* receiver) :
+            _senders(std::make_unique<Sender[]>(count))
+    {
+        for (std::size_t index = 0; index < count; index++)
+        {
+            SignalObject::connect(&_senders[index], receiver, &Sender::sampled, &Receiver::onSampled);
+        }
+    }
+
+private:
+    /**
+     *  \var    _senders
+     *  \brief  Senders of the unrelated connections, which are removed on destruction.
+     */
+    std::unique_ptr<Sender[]> _senders;
+};
+
+/**
+ *  \fn         connectTagged(Sender* sender, Receiver* receiver, std::index_sequence<Ids...>)
+ *  \brief      Connects one signal of each passed signature.
+ *  \tparam     Ids passes the signatures' indices.
+ *  \param[in]  sender passes a pointer to the sender instance.
+ *  \param[in]  receiver passes a pointer to the receiver instance.
+ */
+template<std::size_t... Ids>
+void connectTagged(Sender* sender, Receiver* receiver, std::index_sequence<Ids...>)
+{
+    (SignalObject::connect(sender, receiver, &Sender::tagged<Ids>, &Receiver::onTagged<Ids>), ...);
+}
+
+/**
+ *  \fn         emitTagged(Sender* sender, std::index_sequence<Ids...>)
+ *  \brief      Emits one signal of each passed signature.
+ *  \tparam     Ids passes the signatures' indices.
+ *  \param[in]  sender passes a pointer to the sender instance.
+ */
+template<std::size_t... Ids>
+void emitTagged(Sender* sender, std::index_sequence<Ids...>)
+{
+    (sender->tagged(Tag<Ids>{}, static_cast<int>(Ids)), ...);
+}
+
+#endif //BENCHMARK_FIXTURE_HPP
\ No newline at end of file
@@ -0,0 +1,119 @@
+/**
+ *  \file   bridgeBenchmark.cpp
+ *  \brief  The file measures round trips of signals through a pair of bridges.
+ *  \note   Both sides of the bridge live in the same process and share two channels, one per
+ *          direction, as two cores would inside shared memory. Every emit on the first side
+ *          is re-emitted by a proxy on the second side, which sends it back to a proxy on
+ *          the first side. The program measures the average round trip in
+ *          EMBEDDED_SIGNALS_CLOCK ticks and checks that every emit arrives with its arguments.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmarkFixture.hpp"
+#include "signalBridge.hpp"
+
+#ifndef BENCHMARK_ITERATIONS
+/**
+ *  \def    BENCHMARK_ITERATIONS
+ *  \brief  Number of round trips per signal.
+ */
+#define BENCHMARK_ITERATIONS 1000
+#endif
+
+/**
+ *  \typedef    Channel
+ *  \brief      Channel type shared by both sides.
+ */
+using Channel = BridgeChannel<16>;
+
+/**
+ *  \typedef    Bridge
+ *  \brief      Bridge type used by both sides.
+ */
+using Bridge = SignalBridge<Channel, 2>;
+
+/**
+ *  \var    SampledRoute
+ *  \brief  Route of the sampled signal in both directions.
+ */
+static constexpr std::uint16_t SampledRoute = 0;
+
+/**
+ *  \var    TaggedRoute
+ *  \brief  Route of the tagged signal in both directions.
+ */
+static constexpr std::uint16_t TaggedRoute = 1;
+
+/**
+ *  \var    doorbells
+ *  \brief  Number of doorbells rung by both sides.
+ */
+static std::uint32_t doorbells = 0;
+
+/**
+ *  \fn         ring(void* context)
+ *  \brief      Counts a doorbell instead of raising an interrupt.
+ *  \param[in]  context passes the unused context of the doorbell.
+ */
+static void ring([[maybe_unused]] void* context)
+{
+    doorbells++;
+}
+
+/**
+ *  \fn     main(void)
+ *  \brief  Runs the round trips and prints the results.
+ *  \return Exit code of the program, non-zero if emits were lost or changed.
+ */
+int main(void)
+{
+    static Channel forward;
+    static Channel backward;
+    Bridge near(&forward, &backward);
+    Bridge far(&backward, &forward);
+    Sender sender;
+    Sender remote;
+    Sender echo;
+    Receiver check;
+
+    near.setDoorbell(&ring, nullptr);
+    far.setDoorbell(&ring, nullptr);
+
+    near.transmit(&sender, &Sender::sampled, SampledRoute);
+    near.transmit(&sender, &Sender::tagged<0>, TaggedRoute);
+    far.receive(SampledRoute, &remote, &Sender::sampled);
+    far.receive(TaggedRoute, &remote, &Sender::tagged<0>);
+    far.transmit(&remote, &Sender::sampled, SampledRoute);
+    far.transmit(&remote, &Sender::tagged<0>, TaggedRoute);
+    near.receive(SampledRoute, &echo, &Sender::sampled);
+    near.receive(TaggedRoute, &echo, &Sender::tagged<0>);
+    SignalObject::connect(&echo, &check, &Sender::sampled, &Receiver::onSampled);
+    SignalObject::connect(&echo, &check, &Sender::tagged<0>, &Receiver::onTagged<0>);
+
+    const std::uint32_t start = EMBEDDED_SIGNALS_CLOCK::now();
+    int expected = 0;
+
+    for (int iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++)
+    {
+        sender.sampled(iteration);
+        sender.tagged(Tag<0>{}, -2 * iteration);
+        far.poll();
+        near.poll();
+        expected += iteration - 2 * iteration;
+    }
+
+    const std::uint32_t ticks = (EMBEDDED_SIGNALS_CLOCK::now() - start) / (2 * BENCHMARK_ITERATIONS);
+    const std::uint32_t dropped = forward.dropped() + backward.dropped();
+    const std::size_t rejected = near.rejected() + far.rejected();
+
+    std::printf("%-10s %10s\n", "scenario", "ticks");
+    std::printf("%-10s %10u\n", "roundtrip", static_cast<unsigned>(ticks));
+    std::printf("doorbells=%u dropped=%u rejected=%u\n",
+                static_cast<unsigned>(doorbells), static_cast<unsigned>(dropped), static_cast<unsigned>(rejected));
+
+    return check.sum == expected && dropped == 0 && rejected == 0 &&
+           doorbells == 4 * BENCHMARK_ITERATIONS ? 0 : 1;
+}
\ No newline at end of file
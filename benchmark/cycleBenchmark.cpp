@@ -0,0 +1,278 @@
+/**
+ *  \file   cycleBenchmark.cpp
+ *  \brief  The file measures connect, emit and disconnect with a cycle counter.
+ *  \note   On Cortex-M targets the DWT cycle counter is used, other targets fall back to
+ *          a steady clock and report nanoseconds instead of cycles.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+
+#include "benchmarkFixture.hpp"
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+/**
+ *  \def    BENCHMARK_DWT_CYCCNT
+ *  \brief  Defined if the DWT cycle counter of a Cortex-M core is available.
+ */
+#define BENCHMARK_DWT_CYCCNT
+#endif
+
+#ifndef BENCHMARK_ITERATIONS
+/**
+ *  \def    BENCHMARK_ITERATIONS
+ *  \brief  Number of measured repetitions per scenario.
+ */
+#define BENCHMARK_ITERATIONS 1000
+#endif
+
+#ifndef BENCHMARK_CAPACITY
+/**
+ *  \def    BENCHMARK_CAPACITY
+ *  \brief  Largest number of slots or connections a scenario uses.
+ */
+#define BENCHMARK_CAPACITY 64
+#endif
+
+static_assert(BENCHMARK_CAPACITY < EMBEDDED_SIGNALS_MAX_CONNECTIONS, "The connection pool is too small for the benchmarks.");
+
+/**
+ *  \class  CycleCounter
+ *  \brief  The class reads the platform's cycle counter.
+ */
+class CycleCounter
+{
+public:
+    /**
+     *  \var    Unit
+     *  \brief  Name of the counter's unit.
+     */
+#ifdef BENCHMARK_DWT_CYCCNT
+    static constexpr const char* Unit = "cycles";
+#else
+    static constexpr const char* Unit = "ns";
+#endif
+
+    /**
+     *  \fn     enable(void)
+     *  \brief  Starts the counter.
+     */
+    static void enable(void)
+    {
+#ifdef BENCHMARK_DWT_CYCCNT
+        *reinterpret_cast<volatile std::uint32_t*>(DemcrAddress) |= DemcrTraceEnable;
+        *reinterpret_cast<volatile std::uint32_t*>(CyccntAddress) = 0;
+        *reinterpret_cast<volatile std::uint32_t*>(DwtCtrlAddress) |= DwtCtrlCycleEnable;
+#endif
+    }
+
+    /**
+     *  \fn     now(void)
+     *  \brief  Reads the counter.
+     *  \return Current counter value.
+     */
+    static std::uint64_t now(void)
+    {
+#ifdef BENCHMARK_DWT_CYCCNT
+        return *reinterpret_cast<volatile std::uint32_t*>(CyccntAddress);
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+private:
+#ifdef BENCHMARK_DWT_CYCCNT
+    /**
+     *  \var    DemcrAddress
+     *  \brief  Address of the debug exception and monitor control register.
+     */
+    static constexpr std::uintptr_t DemcrAddress = 0xE000EDFC;
+
+    /**
+     *  \var    DwtCtrlAddress
+     *  \brief  Address of the DWT control register.
+     */
+    static constexpr std::uintptr_t DwtCtrlAddress = 0xE0001000;
+
+    /**
+     *  \var    CyccntAddress
+     *  \brief  Address of the DWT cycle count register.
+     */
+    static constexpr std::uintptr_t CyccntAddress = 0xE0001004;
+
+    /**
+     *  \var    DemcrTraceEnable
+     *  \brief  Bit enabling the DWT unit.
+     */
+    static constexpr std::uint32_t DemcrTraceEnable = 1u << 24;
+
+    /**
+     *  \var    DwtCtrlCycleEnable
+     *  \brief  Bit enabling the cycle counter.
+     */
+    static constexpr std::uint32_t DwtCtrlCycleEnable = 1u << 0;
+#endif
+};
+
+/**
+ *  \fn         measure(const char* name, std::size_t count, Function&& function)
+ *  \brief      Reports the average and worst counter delta of a scenario.
+ *  \tparam     Function passes the scenario's typename.
+ *  \param[in]  name passes the scenario's name.
+ *  \param[in]  count passes the scenario's size parameter.
+ *  \param[in]  function passes the measured operation.
+ */
+template<class Function>
+static void measure(const char* name, std::size_t count, Function&& function)
+{
+    std::uint64_t total = 0;
+    std::uint64_t worst = 0;
+
+    for (std::size_t iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++)
+    {
+        const std::uint64_t start = CycleCounter::now();
+        function();
+        const std::uint64_t delta = CycleCounter::now() - start;
+
+        total += delta;
+        worst = delta > worst ? delta : worst;
+    }
+
+    std::printf("%-28s %5u %10lu %10lu %s\n",
+                name,
+                static_cast<unsigned>(count),
+                static_cast<unsigned long>(total / BENCHMARK_ITERATIONS),
+                static_cast<unsigned long>(worst),
+                CycleCounter::Unit);
+}
+
+/**
+ *  \fn         measureFanout(std::size_t count)
+ *  \brief      Measures emitting a signal with a number of slots against the baselines.
+ *  \param[in]  count passes the number of slots.
+ */
+static void measureFanout(std::size_t count)
+{
+    static Receiver receivers[BENCHMARK_CAPACITY];
+    static std::function<void(int)> slots[BENCHMARK_CAPACITY];
+    Sender sender;
+
+    for (std::size_t index = 0; index < count; index++)
+    {
+        Receiver* receiver = &receivers[index];
+
+        SignalObject::connect(&sender, receiver, &Sender::sampled, &Receiver::onSampled);
+        slots[index] = [receiver](int value){ receiver->onSampled(value); };
+    }
+
+    measure("directCall", count, [count]
+    {
+        for (std::size_t index = 0; index < count; index++)
+        {
+            receivers[index].onSampled(1);
+        }
+    });
+    measure("functionArray", count, [count]
+    {
+        for (std::size_t index = 0; index < count; index++)
+        {
+            slots[index](1);
+        }
+    });
+    measure("emitSlots", count, [&sender]{ sender.sampled(1); });
+}
+
+/**
+ *  \fn         measurePopulated(std::size_t count)
+ *  \brief      Measures emit and connection churn against the connection count of a signature.
+ *  \param[in]  count passes the number of unrelated connections.
+ */
+static void measurePopulated(std::size_t count)
+{
+    Sender sender;
+    Receiver receiver;
+    Population population(count, &receiver);
+
+    measure("connectDisconnect", count, [&sender, &receiver]
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+        SignalObject::disconnect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+    });
+    measure("connectDisconnectHandle", count, [&sender, &receiver]
+    {
+        SignalObject::disconnect(SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled));
+    });
+
+    SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+    measure("emitPopulated", count, [&sender]{ sender.sampled(1); });
+}
+
+/**
+ *  \fn         measureSignatures(std::index_sequence<Ids...> ids)
+ *  \brief      Measures emitting one slot each of a number of distinct signatures.
+ *  \tparam     Ids passes the signatures' indices.
+ *  \param[in]  ids passes the index sequence of the signatures.
+ */
+template<std::size_t... Ids>
+static void measureSignatures(std::index_sequence<Ids...> ids)
+{
+    Sender sender;
+    Receiver receiver;
+
+    connectTagged(&sender, &receiver, ids);
+    measure("emitSignatures", sizeof...(Ids), [&sender, ids]{ emitTagged(&sender, ids); });
+}
+
+/**
+ *  \fn         measurePayload(void)
+ *  \brief      Measures emitting an argument of a specific size by value and by reference.
+ *  \tparam     Size passes the argument's size in bytes.
+ */
+template<std::size_t Size>
+static void measurePayload(void)
+{
+    Sender sender;
+    Receiver receiver;
+    Payload<Size> payload;
+
+    SignalObject::connect(&sender, &receiver, &Sender::copied<Size>, &Receiver::onCopied<Size>);
+    SignalObject::connect(&sender, &receiver, &Sender::referenced<Size>, &Receiver::onReferenced<Size>);
+
+    measure("emitCopied", Size, [&sender, &payload]{ sender.copied(payload); });
+    measure("emitReferenced", Size, [&sender, &payload]{ sender.referenced(payload); });
+}
+
+/**
+ *  \fn     main(void)
+ *  \brief  Runs all scenarios and prints one line per measurement.
+ *  \return Exit code of the program.
+ */
+int main(void)
+{
+    CycleCounter::enable();
+
+    std::printf("%-28s %5s %10s %10s\n", "scenario", "n", "average", "worst");
+
+    for (std::size_t count = 1; count <= BENCHMARK_CAPACITY; count *= 4)
+    {
+        measureFanout(count);
+    }
+
+    for (std::size_t count = 0; count <= BENCHMARK_CAPACITY; count = count ? count * 4 : 1)
+    {
+        measurePopulated(count);
+    }
+
+    measureSignatures(std::make_index_sequence<1>());
+    measureSignatures(std::make_index_sequence<4>());
+    measureSignatures(std::make_index_sequence<16>());
+
+    measurePayload<4>();
+    measurePayload<64>();
+    measurePayload<256>();
+
+    return 0;
+}
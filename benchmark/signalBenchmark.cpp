@@ -0,0 +1,557 @@
+/**
+ *  \file   signalBenchmark.cpp
+ *  \brief  The file measures connect, emit and disconnect on the host with Google Benchmark.
+ */
+
+#include <functional>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmarkFixture.hpp"
+#include "fanOut.hpp"
+
+/**
+ *  \fn         directCall(benchmark::State& state)
+ *  \brief      Measures calling the slots directly as baseline.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void directCall(benchmark::State& state)
+{
+    std::vector<Receiver> receivers(state.range(0));
+
+    for (auto _ : state)
+    {
+        for (Receiver& receiver : receivers)
+        {
+            receiver.onSampled(1);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(directCall)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ *  \fn         functionVector(benchmark::State& state)
+ *  \brief      Measures calling the slots through a vector of std::function as baseline.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void functionVector(benchmark::State& state)
+{
+    std::vector<Receiver> receivers(state.range(0));
+    std::vector<std::function<void(int)>> slots;
+
+    for (Receiver& receiver : receivers)
+    {
+        slots.emplace_back([&receiver](int value){ receiver.onSampled(value); });
+    }
+
+    for (auto _ : state)
+    {
+        for (const std::function<void(int)>& slot : slots)
+        {
+            slot(1);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(functionVector)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ *  \fn         emitSlots(benchmark::State& state)
+ *  \brief      Measures emitting a signal against the number of its slots.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void emitSlots(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+    }
+
+    for (auto _ : state)
+    {
+        sender.sampled(1);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitSlots)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ *  \fn         emitPopulated(benchmark::State& state)
+ *  \brief      Measures emitting a single slot against the total connection count of its signature.
+ *  \param[in]  state passes the benchmark state, its argument is the number of unrelated connections.
+ */
+static void emitPopulated(benchmark::State& state)
+{
+    Sender sender;
+    Receiver receiver;
+    Population population(state.range(0), &receiver);
+
+    SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+
+    for (auto _ : state)
+    {
+        sender.sampled(1);
+    }
+}
+BENCHMARK(emitPopulated)->Arg(0)->RangeMultiplier(4)->Range(1, 1000);
+
+/**
+ *  \fn         emitUnconnected(benchmark::State& state)
+ *  \brief      Measures emitting a signal without any slot.
+ *  \param[in]  state passes the benchmark state.
+ */
+static void emitUnconnected(benchmark::State& state)
+{
+    Sender sender;
+
+    for (auto _ : state)
+    {
+        sender.sampled(1);
+    }
+}
+BENCHMARK(emitUnconnected);
+
+/**
+ *  \fn         emitSignatures(benchmark::State& state)
+ *  \brief      Measures emitting one slot each of a number of distinct signatures.
+ *  \tparam     Count passes the number of signatures.
+ *  \param[in]  state passes the benchmark state.
+ */
+template<std::size_t Count>
+static void emitSignatures(benchmark::State& state)
+{
+    Sender sender;
+    Receiver receiver;
+
+    connectTagged(&sender, &receiver, std::make_index_sequence<Count>());
+
+    for (auto _ : state)
+    {
+        emitTagged(&sender, std::make_index_sequence<Count>());
+    }
+
+    state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK_TEMPLATE(emitSignatures, 1);
+BENCHMARK_TEMPLATE(emitSignatures, 4);
+BENCHMARK_TEMPLATE(emitSignatures, 16);
+
+/**
+ *  \fn         emitCopied(benchmark::State& state)
+ *  \brief      Measures emitting an argument by value against its size.
+ *  \tparam     Size passes the argument's size in bytes.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+template<std::size_t Size>
+static void emitCopied(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+    Payload<Size> payload;
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::copied<Size>, &Receiver::onCopied<Size>);
+    }
+
+    for (auto _ : state)
+    {
+        sender.copied(payload);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * Size);
+}
+BENCHMARK_TEMPLATE(emitCopied, 4)->Arg(1)->Arg(8);
+BENCHMARK_TEMPLATE(emitCopied, 64)->Arg(1)->Arg(8);
+BENCHMARK_TEMPLATE(emitCopied, 1024)->Arg(1)->Arg(8);
+
+/**
+ *  \fn         emitReferenced(benchmark::State& state)
+ *  \brief      Measures emitting an argument by reference against its size.
+ *  \tparam     Size passes the argument's size in bytes.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+template<std::size_t Size>
+static void emitReferenced(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+    Payload<Size> payload;
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::referenced<Size>, &Receiver::onReferenced<Size>);
+    }
+
+    for (auto _ : state)
+    {
+        sender.referenced(payload);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * Size);
+}
+BENCHMARK_TEMPLATE(emitReferenced, 4)->Arg(1)->Arg(8);
+BENCHMARK_TEMPLATE(emitReferenced, 64)->Arg(1)->Arg(8);
+BENCHMARK_TEMPLATE(emitReferenced, 1024)->Arg(1)->Arg(8);
+
+/**
+ *  \fn         emitShared(benchmark::State& state)
+ *  \brief      Measures emitting an argument inside a pooled buffer against its size.
+ *  \note       Each iteration acquires, fills and emits a buffer, which returns to the
+ *              pool after the last slot.
+ *  \tparam     Size passes the argument's size in bytes.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+template<std::size_t Size>
+static void emitShared(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+    BufferPool<Payload<Size>, 4> pool;
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::shared<Size>, &Receiver::onShared<Size>);
+    }
+
+    for (auto _ : state)
+    {
+        PooledBuffer<Payload<Size>> buffer = pool.acquire();
+
+        buffer->bytes[Size - 1] = 1;
+        sender.shared(std::move(buffer).share());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * Size);
+}
+BENCHMARK_TEMPLATE(emitShared, 4)->Arg(1)->Arg(8);
+BENCHMARK_TEMPLATE(emitShared, 64)->Arg(1)->Arg(8);
+BENCHMARK_TEMPLATE(emitShared, 1024)->Arg(1)->Arg(8);
+
+/**
+ *  \fn         emitSamples(benchmark::State& state)
+ *  \brief      Measures emitting a block of samples one by one.
+ *  \param[in]  state passes the benchmark state, its argument is the number of samples.
+ */
+static void emitSamples(benchmark::State& state)
+{
+    Sender sender;
+    Receiver receivers[4];
+    std::vector<int> samples(state.range(0), 1);
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+    }
+
+    for (auto _ : state)
+    {
+        for (int sample : samples)
+        {
+            sender.sampled(sample);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitSamples)->Arg(64)->Arg(256);
+
+/**
+ *  \fn         emitBatch(benchmark::State& state)
+ *  \brief      Measures emitting a block of samples as a single batch.
+ *  \param[in]  state passes the benchmark state, its argument is the number of samples.
+ */
+static void emitBatch(benchmark::State& state)
+{
+    Sender sender;
+    Receiver receivers[4];
+    std::vector<int> samples(state.range(0), 1);
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+    }
+
+    for (auto _ : state)
+    {
+        SignalObject::fireBatch(&sender, &Sender::sampled, samples);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitBatch)->Arg(64)->Arg(256);
+
+/**
+ *  \fn         emitThrottled(benchmark::State& state)
+ *  \brief      Measures emitting a signal whose slots drop the emits through a throttle policy.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void emitThrottled(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+    Throttle<int> throttle(UINT32_MAX / 2);
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled,
+                              ConnectionType::Direct, 0, {}, &throttle);
+    }
+
+    for (auto _ : state)
+    {
+        sender.sampled(1);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitThrottled)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ *  \fn         emitRelayed(benchmark::State& state)
+ *  \brief      Measures emitting through a chain of senders whose signals are connected as slots.
+ *  \param[in]  state passes the benchmark state, its argument is the number of hops.
+ */
+static void emitRelayed(benchmark::State& state)
+{
+    std::vector<Sender> senders(state.range(0) + 1);
+    Receiver receiver;
+
+    for (std::size_t hop = 0; hop + 1 < senders.size(); hop++)
+    {
+        SignalObject::connect(&senders[hop], &senders[hop + 1], &Sender::sampled, &Sender::sampled);
+    }
+
+    SignalObject::connect(&senders.back(), &receiver, &Sender::sampled, &Receiver::onSampled);
+
+    for (auto _ : state)
+    {
+        senders.front().sampled(1);
+    }
+}
+BENCHMARK(emitRelayed)->DenseRange(1, 4);
+
+/**
+ *  \fn         emitForwarded(benchmark::State& state)
+ *  \brief      Measures emitting through a chain of senders whose signals are forwarded.
+ *  \param[in]  state passes the benchmark state, its argument is the number of hops.
+ */
+static void emitForwarded(benchmark::State& state)
+{
+    std::vector<Sender> senders(state.range(0) + 1);
+    Receiver receiver;
+
+    for (std::size_t hop = 0; hop + 1 < senders.size(); hop++)
+    {
+        SignalObject::forward(&senders[hop], &senders[hop + 1], &Sender::sampled, &Sender::sampled);
+    }
+
+    SignalObject::connect(&senders.back(), &receiver, &Sender::sampled, &Receiver::onSampled);
+
+    for (auto _ : state)
+    {
+        senders.front().sampled(1);
+    }
+}
+BENCHMARK(emitForwarded)->DenseRange(1, 4);
+
+/**
+ *  \fn         connectDisconnect(benchmark::State& state)
+ *  \brief      Measures connecting and disconnecting by signal and slot against the connection count.
+ *  \param[in]  state passes the benchmark state, its argument is the number of unrelated connections.
+ */
+static void connectDisconnect(benchmark::State& state)
+{
+    Sender sender;
+    Receiver receiver;
+    Population population(state.range(0), &receiver);
+
+    for (auto _ : state)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+        SignalObject::disconnect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+    }
+}
+BENCHMARK(connectDisconnect)->Arg(0)->RangeMultiplier(4)->Range(1, 1000);
+
+/**
+ *  \fn         connectDisconnectHandle(benchmark::State& state)
+ *  \brief      Measures connecting and disconnecting by handle against the connection count.
+ *  \param[in]  state passes the benchmark state, its argument is the number of unrelated connections.
+ */
+static void connectDisconnectHandle(benchmark::State& state)
+{
+    Sender sender;
+    Receiver receiver;
+    Population population(state.range(0), &receiver);
+
+    for (auto _ : state)
+    {
+        SignalObject::disconnect(SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled));
+    }
+}
+BENCHMARK(connectDisconnectHandle)->Arg(0)->RangeMultiplier(4)->Range(1, 1000);
+
+/**
+ *  \fn         fanoutChurn(benchmark::State& state)
+ *  \brief      Measures connecting and disconnecting many slots of a single signal.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void fanoutChurn(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+
+    for (auto _ : state)
+    {
+        for (Receiver& receiver : receivers)
+        {
+            SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+        }
+
+        sender.disconnectAll();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fanoutChurn)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ *  \fn         rewireSlots(benchmark::State& state)
+ *  \brief      Measures connecting many slots of a signal and disconnecting each by its slot.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void rewireSlots(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+
+    for (auto _ : state)
+    {
+        for (Receiver& receiver : receivers)
+        {
+            SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+        }
+
+        for (Receiver& receiver : receivers)
+        {
+            SignalObject::disconnect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(rewireSlots)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ *  \fn         rewireGroup(benchmark::State& state)
+ *  \brief      Measures connecting many slots of a signal into a group and releasing the group.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void rewireGroup(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+    ConnectionGroup group;
+
+    for (auto _ : state)
+    {
+        for (Receiver& receiver : receivers)
+        {
+            SignalObject::join(group, SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled));
+        }
+
+        group.release();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(rewireGroup)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ *  \fn         emitGrouped(benchmark::State& state)
+ *  \brief      Measures emitting a signal whose slots are members of an enabled group.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void emitGrouped(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+    ConnectionGroup group;
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::join(group, SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled));
+    }
+
+    for (auto _ : state)
+    {
+        sender.sampled(1);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitGrouped)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ *  \fn         emitBlocked(benchmark::State& state)
+ *  \brief      Measures emitting a signal whose receivers block their slots.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void emitBlocked(benchmark::State& state)
+{
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+        receiver.blockSlots(true);
+    }
+
+    for (auto _ : state)
+    {
+        sender.sampled(1);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitBlocked)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ *  \fn         emitParallel(benchmark::State& state)
+ *  \brief      Measures emitting a signal whose slots are split across a fan-out pool.
+ *  \note       The slots are as cheap as those of emitSlots, so the difference is the cost
+ *              of waking the workers and waiting for them, which slow slots amortize.
+ *  \param[in]  state passes the benchmark state, its argument is the number of slots.
+ */
+static void emitParallel(benchmark::State& state)
+{
+    static FanOut<3> fanOut;
+    Sender sender;
+    std::vector<Receiver> receivers(state.range(0));
+
+    for (Receiver& receiver : receivers)
+    {
+        SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+        receiver.allowParallelSlots(true);
+    }
+
+    for (auto _ : state)
+    {
+        SignalObject::fireParallel(fanOut, &sender, &Sender::sampled, 1);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitParallel)->RangeMultiplier(4)->Range(1, 256);
+
+BENCHMARK_MAIN();
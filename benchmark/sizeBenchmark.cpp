@@ -0,0 +1,56 @@
+/**
+ *  \file   sizeBenchmark.cpp
+ *  \brief  The file instantiates many signatures to measure the library's code size.
+ *  \note   The sizeReport target builds the file in the default and the code size optimized
+ *          mode and sums the symbols of the library per mode from the linker map and the
+ *          symbol table. The program prints the connection memory of all signatures as well.
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+
+#include "benchmarkFixture.hpp"
+
+#ifndef BENCHMARK_SIGNATURES
+/**
+ *  \def    BENCHMARK_SIGNATURES
+ *  \brief  Number of distinct signatures instantiated.
+ */
+#define BENCHMARK_SIGNATURES 32
+#endif
+
+/**
+ *  \fn         disconnectTagged(Sender* sender, Receiver* receiver, std::index_sequence<Ids...>)
+ *  \brief      Disconnects one signal of each passed signature by its slot.
+ *  \tparam     Ids passes the signatures' indices.
+ *  \param[in]  sender passes a pointer to the sender instance.
+ *  \param[in]  receiver passes a pointer to the receiver instance.
+ */
+template<std::size_t... Ids>
+void disconnectTagged(Sender* sender, Receiver* receiver, std::index_sequence<Ids...>)
+{
+    (SignalObject::disconnect(sender, receiver, &Sender::tagged<Ids>, &Receiver::onTagged<Ids>), ...);
+}
+
+/**
+ *  \fn     main(void)
+ *  \brief  Connects, emits and disconnects all signatures once.
+ *  \return Exit code of the program.
+ */
+int main(void)
+{
+    Sender sender;
+    Receiver receiver;
+
+    connectTagged(&sender, &receiver, std::make_index_sequence<BENCHMARK_SIGNATURES>{});
+    emitTagged(&sender, std::make_index_sequence<BENCHMARK_SIGNATURES>{});
+    disconnectTagged(&sender, &receiver, std::make_index_sequence<BENCHMARK_SIGNATURES>{});
+
+    const SignatureFootprint footprint = Footprint::total();
+
+    std::printf("signatures=%d sum=%d\n", BENCHMARK_SIGNATURES, receiver.sum);
+    std::printf("reserved=%zu peak=%zu bytes\n", footprint.bytesReserved, footprint.peakBytes);
+
+    return 0;
+}
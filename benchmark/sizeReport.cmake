@@ -0,0 +1,57 @@
+# Sums the code size of the library's symbols inside the size benchmark binaries.
+# The linker maps written next to the binaries break the sizes down per object file.
+#
+# Usage: cmake -DNM=<nm> -DBINARIES="<binary>;<binary>" -P sizeReport.cmake
+
+if(NOT NM OR NOT BINARIES)
+    message(FATAL_ERROR "NM and BINARIES must be set.")
+endif()
+
+set(GROUPS ConnectionCore ConnectionPool SignalObject Connection Delegate)
+
+foreach(BINARY IN LISTS BINARIES)
+    execute_process(
+        COMMAND ${NM} --print-size --size-sort -C ${BINARY}
+        OUTPUT_VARIABLE SYMBOLS
+        RESULT_VARIABLE RESULT
+    )
+
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "Reading the symbols of ${BINARY} failed.")
+    endif()
+
+    string(REPLACE "\n" ";" SYMBOLS "${SYMBOLS}")
+    set(TOTAL 0)
+    set(CODE 0)
+
+    foreach(GROUP IN LISTS GROUPS)
+        set(SIZE_${GROUP} 0)
+        set(COUNT_${GROUP} 0)
+    endforeach()
+
+    foreach(SYMBOL IN LISTS SYMBOLS)
+        if(NOT SYMBOL MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tTwW] (.*)$")
+            continue()
+        endif()
+
+        set(NAME "${CMAKE_MATCH_2}")
+        math(EXPR SIZE "0x${CMAKE_MATCH_1}")
+        math(EXPR CODE "${CODE} + ${SIZE}")
+
+        foreach(GROUP IN LISTS GROUPS)
+            if(NAME MATCHES "^(void |bool |auto |[A-Za-z_:<>]+ )?${GROUP}[<:]")
+                math(EXPR SIZE_${GROUP} "${SIZE_${GROUP}} + ${SIZE}")
+                math(EXPR COUNT_${GROUP} "${COUNT_${GROUP}} + 1")
+                math(EXPR TOTAL "${TOTAL} + ${SIZE}")
+                break()
+            endif()
+        endforeach()
+    endforeach()
+
+    get_filename_component(NAME ${BINARY} NAME)
+    message(STATUS "${NAME}: ${CODE} bytes of code, ${TOTAL} bytes in library functions")
+
+    foreach(GROUP IN LISTS GROUPS)
+        message(STATUS "    ${GROUP}: ${SIZE_${GROUP}} bytes in ${COUNT_${GROUP}} functions")
+    endforeach()
+endforeach()
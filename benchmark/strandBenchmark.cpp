@@ -0,0 +1,351 @@
+/**
+ *  \file   strandBenchmark.cpp
+ *  \brief  The file compares slots called by the emitting thread with slots executed by a worker pool.
+ *  \note   Several producer threads emit into receivers owning a strand each. The program
+ *          measures the duration of all emits in microseconds, once with direct connections
+ *          on a single thread and once with queued connections executed by the pool, and
+ *          checks that every receiver got each producer's emits in order. Producers wait
+ *          while a consumer lags behind, so the strands never drop samples.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+#include "signalObject.hpp"
+#include "workerPool.hpp"
+
+#ifndef BENCHMARK_ITERATIONS
+/**
+ *  \def    BENCHMARK_ITERATIONS
+ *  \brief  Number of emits per producer.
+ */
+#define BENCHMARK_ITERATIONS 10000
+#endif
+
+#ifndef BENCHMARK_PRODUCERS
+/**
+ *  \def    BENCHMARK_PRODUCERS
+ *  \brief  Number of emitting threads.
+ */
+#define BENCHMARK_PRODUCERS 4
+#endif
+
+#ifndef BENCHMARK_RECEIVERS
+/**
+ *  \def    BENCHMARK_RECEIVERS
+ *  \brief  Number of receivers connected to every producer.
+ */
+#define BENCHMARK_RECEIVERS 8
+#endif
+
+#ifndef BENCHMARK_WORKERS
+/**
+ *  \def    BENCHMARK_WORKERS
+ *  \brief  Number of worker threads of the pool.
+ */
+#define BENCHMARK_WORKERS 4
+#endif
+
+#ifndef BENCHMARK_WORK
+/**
+ *  \def    BENCHMARK_WORK
+ *  \brief  Number of loop iterations a slot spends per call.
+ */
+#define BENCHMARK_WORK 256
+#endif
+
+/**
+ *  \var    Window
+ *  \brief  Number of samples a producer may be ahead of each consumer, which keeps the
+ *          strands from overflowing.
+ */
+static constexpr int Window = 1024 / BENCHMARK_PRODUCERS / 2;
+
+/**
+ *  \var    pool
+ *  \brief  Worker pool executing the strands of the receivers.
+ */
+static WorkerPool<BENCHMARK_WORKERS> pool;
+
+/**
+ *  \class  Producer
+ *  \brief  The class emits numbered samples.
+ */
+class Producer : public SignalObject
+{
+public:
+    /**
+     *  \fn         produced(int producer, int sequence)
+     *  \brief      This signal is emitted for a new sample.
+     *  \param[in]  producer passes the index of the producer.
+     *  \param[in]  sequence passes the number of the sample.
+     */
+    void produced(int producer, int sequence)
+    {
+        fireAllSlots(this, &Producer::produced, producer, sequence);
+    }
+};
+
+/**
+ *  \class  Consumer
+ *  \brief  The class checks the order of the samples it receives on its strand.
+ */
+class Consumer : public SignalObject
+{
+public:
+    /**
+     *  \fn     Consumer(void)
+     *  \brief  The constructor assigns the consumer's strand as its event queue.
+     */
+    Consumer(void) :
+            _strand(pool)
+    {
+        setEventQueue(&_strand);
+    }
+
+    /**
+     *  \fn         onProduced(int producer, int sequence)
+     *  \brief      Spends some work on a sample and checks that it follows the previous one.
+     *  \param[in]  producer passes the index of the producer.
+     *  \param[in]  sequence passes the number of the sample.
+     */
+    void onProduced(int producer, int sequence)
+    {
+        for (int iteration = 0; iteration < BENCHMARK_WORK; iteration++)
+        {
+            _work = _work + iteration;
+        }
+
+        if (sequence <= _last[producer].load(std::memory_order_relaxed))
+        {
+            _ordered = false;
+        }
+
+        _last[producer].store(sequence, std::memory_order_relaxed);
+        _count.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     *  \fn     reset(void)
+     *  \brief  Forgets the received samples.
+     */
+    void reset(void)
+    {
+        for (std::atomic<int>& last : _last)
+        {
+            last.store(-1, std::memory_order_relaxed);
+        }
+
+        _count.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn     done(void) const
+     *  \brief  Checks if every emitted sample was received or dropped by the strand.
+     *  \return Boolean indicating result of check.
+     */
+    bool done(void) const
+    {
+        return _count.load(std::memory_order_acquire) + _strand.dropped() >=
+               static_cast<std::size_t>(BENCHMARK_PRODUCERS) * BENCHMARK_ITERATIONS;
+    }
+
+    /**
+     *  \fn         behind(int producer, int sequence) const
+     *  \brief      Checks if the consumer lags too far behind a producer's next sample.
+     *  \param[in]  producer passes the index of the producer.
+     *  \param[in]  sequence passes the number of the producer's next sample.
+     *  \return     Boolean indicating result of check.
+     */
+    bool behind(int producer, int sequence) const
+    {
+        return sequence - _last[producer].load(std::memory_order_relaxed) > Window;
+    }
+
+    /**
+     *  \fn     ordered(void) const
+     *  \brief  Checks if the samples of each producer arrived in order.
+     *  \return Boolean indicating result of check.
+     */
+    bool ordered(void) const
+    {
+        return _ordered;
+    }
+
+    /**
+     *  \fn     dropped(void) const
+     *  \brief  Returns the number of samples the strand dropped due to overflow.
+     *  \return Number of dropped samples.
+     */
+    std::size_t dropped(void) const
+    {
+        return _strand.dropped();
+    }
+
+private:
+    /**
+     *  \var    _strand
+     *  \brief  Strand executing the consumer's queued slot calls.
+     */
+    Strand<1024> _strand;
+
+    /**
+     *  \var    _last
+     *  \brief  Number of the last sample received from each producer.
+     */
+    std::atomic<int> _last[BENCHMARK_PRODUCERS]{};
+
+    /**
+     *  \var    _count
+     *  \brief  Number of received samples.
+     */
+    std::atomic<std::size_t> _count = 0;
+
+    /**
+     *  \var    _work
+     *  \brief  Accumulated work preventing the loop from being optimized away.
+     */
+    volatile int _work = 0;
+
+    /**
+     *  \var    _ordered
+     *  \brief  Boolean indicating if all samples arrived in order.
+     */
+    bool _ordered = true;
+};
+
+/**
+ *  \var    producers
+ *  \brief  Emitting objects, one per producer thread.
+ */
+static Producer producers[BENCHMARK_PRODUCERS];
+
+/**
+ *  \var    consumers
+ *  \brief  Receivers connected to every producer.
+ */
+static Consumer consumers[BENCHMARK_RECEIVERS];
+
+/**
+ *  \fn         connectAll(ConnectionType type)
+ *  \brief      Connects every producer to every consumer.
+ *  \param[in]  type passes whether the slots are called directly or via the strands.
+ */
+static void connectAll(ConnectionType type)
+{
+    for (Producer& producer : producers)
+    {
+        for (Consumer& consumer : consumers)
+        {
+            SignalObject::connect(&producer, &consumer, &Producer::produced, &Consumer::onProduced, type);
+        }
+    }
+}
+
+/**
+ *  \fn         elapsed(std::chrono::steady_clock::time_point start)
+ *  \brief      Returns the time passed since a point in time.
+ *  \param[in]  start passes the point in time.
+ *  \return     Number of microseconds.
+ */
+static long long elapsed(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ *  \fn     main(void)
+ *  \brief  Runs both scenarios and prints one line per scenario.
+ *  \return Exit code of the program, non-zero if samples were lost or reordered.
+ */
+int main(void)
+{
+    for (Consumer& consumer : consumers)
+    {
+        consumer.reset();
+    }
+
+    connectAll(ConnectionType::Direct);
+
+    const std::chrono::steady_clock::time_point serialStart = std::chrono::steady_clock::now();
+
+    for (int sequence = 0; sequence < BENCHMARK_ITERATIONS; sequence++)
+    {
+        for (int producer = 0; producer < BENCHMARK_PRODUCERS; producer++)
+        {
+            producers[producer].produced(producer, sequence);
+        }
+    }
+
+    const long long serial = elapsed(serialStart);
+
+    for (Producer& producer : producers)
+    {
+        producer.disconnectAll();
+    }
+
+    for (Consumer& consumer : consumers)
+    {
+        consumer.reset();
+    }
+
+    connectAll(ConnectionType::Queued);
+
+    const std::chrono::steady_clock::time_point pooledStart = std::chrono::steady_clock::now();
+    std::thread threads[BENCHMARK_PRODUCERS];
+
+    for (int producer = 0; producer < BENCHMARK_PRODUCERS; producer++)
+    {
+        threads[producer] = std::thread([producer]
+                                        {
+                                            for (int sequence = 0; sequence < BENCHMARK_ITERATIONS; sequence++)
+                                            {
+                                                for (const Consumer& consumer : consumers)
+                                                {
+                                                    while (consumer.behind(producer, sequence))
+                                                    {
+                                                        std::this_thread::yield();
+                                                    }
+                                                }
+
+                                                producers[producer].produced(producer, sequence);
+                                            }
+                                        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    bool ordered = true;
+    std::size_t dropped = 0;
+
+    for (Consumer& consumer : consumers)
+    {
+        while (!consumer.done())
+        {
+            std::this_thread::yield();
+        }
+
+        ordered = ordered && consumer.ordered();
+        dropped += consumer.dropped();
+    }
+
+    const long long pooled = elapsed(pooledStart);
+
+    std::printf("%-10s %10s\n", "scenario", "us");
+    std::printf("%-10s %10lld\n", "serial", serial);
+    std::printf("%-10s %10lld\n", "pooled", pooled);
+    std::printf("workers=%u dropped=%u overflows=%u ordered=%d\n",
+                static_cast<unsigned>(pool.workers()),
+                static_cast<unsigned>(dropped),
+                static_cast<unsigned>(pool.overflows()),
+                ordered);
+
+    return ordered && dropped == 0 && pool.overflows() == 0 ? 0 : 1;
+}
\ No newline at end of file
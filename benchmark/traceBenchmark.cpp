@@ -0,0 +1,114 @@
+/**
+ *  \file   traceBenchmark.cpp
+ *  \brief  The file compares recording emits into the trace ring with formatting a log line.
+ *  \note   The program is built with EMBEDDED_SIGNALS_TRACE. It measures the average emit in
+ *          EMBEDDED_SIGNALS_CLOCK ticks without tracing, with the signal traced and with a
+ *          printf style log line per emit, then saves the ring and replays it into a second
+ *          sender to check that every recorded emit arrives with its arguments.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmarkFixture.hpp"
+#include "signalTrace.hpp"
+
+#ifndef BENCHMARK_ITERATIONS
+/**
+ *  \def    BENCHMARK_ITERATIONS
+ *  \brief  Number of emits per scenario.
+ */
+#define BENCHMARK_ITERATIONS 1000
+#endif
+
+/**
+ *  \var    TracedChannel
+ *  \brief  Channel of the traced signal.
+ */
+static constexpr std::uint16_t TracedChannel = 1;
+
+/**
+ *  \fn         measure(Emit emit)
+ *  \brief      Measures the average duration of an emit.
+ *  \tparam     Emit passes the type of the emitting callable.
+ *  \param[in]  emit passes the callable emitting with the iteration as argument.
+ *  \return     Average number of clock ticks per emit.
+ */
+template<class Emit>
+static std::uint32_t measure(Emit emit)
+{
+    const std::uint32_t start = EMBEDDED_SIGNALS_CLOCK::now();
+
+    for (int iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++)
+    {
+        emit(iteration);
+    }
+
+    return (EMBEDDED_SIGNALS_CLOCK::now() - start) / BENCHMARK_ITERATIONS;
+}
+
+/**
+ *  \fn     main(void)
+ *  \brief  Runs all scenarios and the replay, then prints one line per scenario.
+ *  \return Exit code of the program, non-zero if the replay lost or changed emits.
+ */
+int main(void)
+{
+    static unsigned char stream[SignalTrace::StreamSize];
+    static char line[64];
+    Sender sender;
+    Receiver receiver;
+
+    SignalObject::connect(&sender, &receiver, &Sender::sampled, &Receiver::onSampled);
+
+    const std::uint32_t plain = measure([&sender](int value)
+                                        {
+                                            sender.sampled(value);
+                                        });
+
+    SignalTrace::attach(TracedChannel, &sender, &Sender::sampled);
+    SignalTrace::start();
+
+    const std::uint32_t traced = measure([&sender](int value)
+                                         {
+                                             sender.sampled(value);
+                                         });
+
+    SignalTrace::stop();
+
+    const std::uint32_t logged = measure([&sender](int value)
+                                         {
+                                             std::snprintf(line, sizeof(line), "%08x sampled %p %d\n",
+                                                           static_cast<unsigned>(EMBEDDED_SIGNALS_CLOCK::now()),
+                                                           static_cast<void*>(&sender), value);
+                                             sender.sampled(value);
+                                         });
+
+    const std::size_t size = SignalTrace::save(stream);
+    Sender replayed;
+    Receiver check;
+
+    SignalObject::connect(&replayed, &check, &Sender::sampled, &Receiver::onSampled);
+    SignalTrace::detach(TracedChannel);
+    SignalTrace::attach(TracedChannel, &replayed, &Sender::sampled);
+
+    TraceReplay replay(std::span<const unsigned char>(stream, size));
+    const std::uint32_t count = replay.run();
+
+    int expected = 0;
+
+    for (int value = BENCHMARK_ITERATIONS - static_cast<int>(count); value < BENCHMARK_ITERATIONS; value++)
+    {
+        expected += value;
+    }
+
+    std::printf("%-10s %10s\n", "scenario", "ticks");
+    std::printf("%-10s %10u\n", "plain", static_cast<unsigned>(plain));
+    std::printf("%-10s %10u\n", "traced", static_cast<unsigned>(traced));
+    std::printf("%-10s %10u\n", "printf", static_cast<unsigned>(logged));
+    std::printf("stream=%zu bytes replayed=%u overwritten=%u\n",
+                size, static_cast<unsigned>(count), static_cast<unsigned>(SignalTrace::overwritten()));
+
+    return replay.isValid() && count == SignalTrace::Records && check.sum == expected ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+/**
+ *  \file   wcetBenchmark.cpp
+ *  \brief  The file reports the worst-case emit duration per signal with the wiring frozen.
+ *  \note   The program is built with EMBEDDED_SIGNALS_INSTRUMENTATION. It wires a population
+ *          of unrelated connections and a few signals of different fan-out, freezes the
+ *          wiring and drives every signal repeatedly. Each signal is reported with the probes
+ *          of its lookup and the connections its emit walks, which are the structural bound,
+ *          and the longest emit measured in EMBEDDED_SIGNALS_CLOCK ticks, which are cycles on
+ *          Cortex-M targets and nanoseconds elsewhere.
+ */
+
+#include <cstddef>
+#include <cstdio>
+
+#include "benchmarkFixture.hpp"
+#include "instrumentation.hpp"
+#include "wiring.hpp"
+
+#ifndef BENCHMARK_ITERATIONS
+/**
+ *  \def    BENCHMARK_ITERATIONS
+ *  \brief  Number of emits per signal.
+ */
+#define BENCHMARK_ITERATIONS 1000
+#endif
+
+#ifndef BENCHMARK_CAPACITY
+/**
+ *  \def    BENCHMARK_CAPACITY
+ *  \brief  Number of unrelated connections and largest fan-out.
+ */
+#define BENCHMARK_CAPACITY 64
+#endif
+
+static_assert(2 * BENCHMARK_CAPACITY + 16 < EMBEDDED_SIGNALS_MAX_CONNECTIONS, "The connection pool is too small for the benchmark.");
+
+/**
+ *  \var    Fanouts
+ *  \brief  Number of slots of each measured signal.
+ */
+static constexpr std::size_t Fanouts[] = {1, 4, BENCHMARK_CAPACITY};
+
+/**
+ *  \var    Signals
+ *  \brief  Number of measured signals, the last one forwards to the first.
+ */
+static constexpr std::size_t Signals = sizeof(Fanouts) / sizeof(Fanouts[0]) + 1;
+
+/**
+ *  \fn         nameOf(const SignalObject* sender, const Sender* senders)
+ *  \brief      Names a reported sender.
+ *  \param[in]  sender passes a pointer to the reported sender.
+ *  \param[in]  senders passes the measured senders.
+ *  \return     Index of the measured sender or Signals for unrelated ones.
+ */
+static std::size_t nameOf(const SignalObject* sender, const Sender* senders)
+{
+    for (std::size_t index = 0; index < Signals; index++)
+    {
+        if (sender == &senders[index])
+        {
+            return index;
+        }
+    }
+
+    return Signals;
+}
+
+/**
+ *  \fn     main(void)
+ *  \brief  Wires, freezes and drives all signals, then prints one line per signal.
+ *  \return Exit code of the program, non-zero if a wiring change passed the frozen lock.
+ */
+int main(void)
+{
+    static Receiver receivers[BENCHMARK_CAPACITY];
+    static Sender senders[Signals];
+    Population population(BENCHMARK_CAPACITY, &receivers[0]);
+
+    for (std::size_t signal = 0; signal + 1 < Signals; signal++)
+    {
+        for (std::size_t slot = 0; slot < Fanouts[signal]; slot++)
+        {
+            SignalObject::connect(&senders[signal], &receivers[slot], &Sender::sampled, &Receiver::onSampled);
+        }
+    }
+
+    SignalObject::forward(&senders[Signals - 1], &senders[0], &Sender::sampled, &Sender::sampled);
+
+    Wiring::freeze();
+
+    const bool refused = !SignalObject::connect(&senders[0], &receivers[0], &Sender::sampled, &Receiver::onSampled).isValid();
+
+    for (std::size_t iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++)
+    {
+        for (Sender& sender : senders)
+        {
+            sender.sampled(1);
+        }
+    }
+
+    SignalReport reports[Signals];
+    const std::size_t count = Instrumentation::signals(reports);
+
+    std::printf("%-10s %8s %12s %8s %10s\n", "signal", "probes", "connections", "emits", "worst");
+
+    for (std::size_t index = 0; index < count; index++)
+    {
+        const std::size_t name = nameOf(reports[index].sender, senders);
+
+        if (name == Signals)
+        {
+            std::printf("%-10s ", "unrelated");
+        }
+        else
+        {
+            std::printf("sender%-4u ", static_cast<unsigned>(name));
+        }
+
+        std::printf("%8u %12u %8u %10u\n",
+                    static_cast<unsigned>(reports[index].probes),
+                    static_cast<unsigned>(reports[index].connections),
+                    static_cast<unsigned>(reports[index].emits),
+                    static_cast<unsigned>(reports[index].worst));
+    }
+
+    std::printf("refused=%d violations=%u\n", refused, static_cast<unsigned>(Wiring::violations()));
+
+    return refused && Wiring::violations() == 1 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ *  \file   argument.hpp
+ *  \brief  The file implements the argument passing of signals to their slots.
+ */
+
+#ifndef ARGUMENT_HPP
+#define ARGUMENT_HPP
+
+#include <type_traits>
+
+/**
+ *  \typedef    Argument
+ *  \brief      Type a slot argument is passed through the dispatch chain with.
+ *  \details    Reference parameters are passed as they are, value parameters as rvalue
+ *              references, so the value is only copied or moved once into the slot itself.
+ *  \tparam     Type passes the parameter's type of the signal's signature.
+ */
+template<class Type>
+using Argument = std::conditional_t<std::is_reference_v<Type>, Type, Type&&>;
+
+/**
+ *  \fn         passArgument(Value& value)
+ *  \brief      Prepares a signal argument for a single slot call.
+ *  \details    Reference parameters refer to the emitted value. Value parameters receive
+ *              the emitted value itself if it may be moved, otherwise a copy of it.
+ *  \tparam     Type passes the parameter's type of the signal's signature.
+ *  \tparam     Movable passes whether the emitted value may be moved from.
+ *  \tparam     Value passes the type of the emitted value.
+ *  \param[in]  value passes the emitted value.
+ *  \return     Argument ready to bind to an Argument<Type> parameter.
+ */
+template<class Type, bool Movable, class Value>
+decltype(auto) passArgument(Value& value)
+{
+    if constexpr (std::is_reference_v<Type>)
+    {
+        return static_cast<Type>(value);
+    }
+    else if constexpr (Movable)
+    {
+        return static_cast<Value&&>(value);
+    }
+    else
+    {
+        return std::remove_cvref_t<Type>(value);
+    }
+}
+
+#endif //ARGUMENT_HPP
\ No newline at end of file
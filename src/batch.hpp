@@ -0,0 +1,101 @@
+/**
+ *  \file   batch.hpp
+ *  \brief  The file implements the argument blocks of batched signal emission.
+ */
+
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+#include "argument.hpp"
+
+/**
+ *  \struct BatchTraits
+ *  \brief  The struct describes a single set of arguments inside a batch.
+ *  \note   Signals with multiple parameters store their arguments as tuple.
+ *  \tparam ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+struct BatchTraits
+{
+    /**
+     *  \typedef    Element
+     *  \brief      Type of a single set of arguments.
+     */
+    using Element = std::tuple<std::decay_t<ParamPack>...>;
+
+    /**
+     *  \fn         invoke(Function& function, const Element& element)
+     *  \brief      Calls a callable with a single set of arguments.
+     *  \note       Value parameters receive copies, reference parameters refer to the batch.
+     *  \tparam     Function passes the callable's typename.
+     *  \param[in]  function passes the callable to call.
+     *  \param[in]  element passes the set of arguments.
+     */
+    template<class Function>
+    static void invoke(Function& function, const Element& element)
+    {
+        std::apply([&function](const auto&... values) { function(passArgument<ParamPack, false>(values)...); },
+                   element);
+    }
+};
+
+/**
+ *  \struct BatchTraits
+ *  \brief  The struct describes a single argument inside a batch.
+ *  \note   Signals with a single parameter store their arguments as plain values, so a block
+ *          of samples can be emitted as it is.
+ *  \tparam Param passes the signal's parameter.
+ */
+template<class Param>
+struct BatchTraits<Param>
+{
+    /**
+     *  \typedef    Element
+     *  \brief      Type of a single argument.
+     */
+    using Element = std::decay_t<Param>;
+
+    /**
+     *  \fn         invoke(Function& function, const Element& element)
+     *  \brief      Calls a callable with a single argument.
+     *  \tparam     Function passes the callable's typename.
+     *  \param[in]  function passes the callable to call.
+     *  \param[in]  element passes the argument.
+     */
+    template<class Function>
+    static void invoke(Function& function, const Element& element)
+    {
+        function(passArgument<Param, false>(element));
+    }
+};
+
+/**
+ *  \typedef    BatchElement
+ *  \brief      Type of a single set of arguments inside a batch.
+ *  \tparam     ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+using BatchElement = typename BatchTraits<ParamPack...>::Element;
+
+/**
+ *  \typedef    Batch
+ *  \brief      Type of a block of argument sets emitted at once.
+ *  \tparam     ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+using Batch = std::span<const BatchElement<ParamPack...>>;
+
+/**
+ *  \concept    isBatchable
+ *  \brief      Checks if the signal's parameters can be called with the elements of a batch.
+ *  \note       Non-const lvalue reference parameters cannot bind to the batch's elements.
+ *  \tparam     ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+concept isBatchable = (std::is_constructible_v<ParamPack, const std::decay_t<ParamPack>&> && ...);
+
+#endif //BATCH_HPP
\ No newline at end of file
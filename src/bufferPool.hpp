@@ -0,0 +1,497 @@
+/**
+ *  \file   bufferPool.hpp
+ *  \brief  The file implements reference counted buffers taken from a fixed-size pool.
+ */
+
+#ifndef BUFFER_POOL_HPP
+#define BUFFER_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+template<class Type>
+class BufferPoolBase;
+
+template<class Type>
+class SharedBuffer;
+
+/**
+ *  \struct BufferBlock
+ *  \brief  The struct stores a buffer of a pool together with its reference count.
+ *  \tparam Type passes the buffer's content type.
+ */
+template<class Type>
+struct BufferBlock
+{
+    /**
+     *  \var    references
+     *  \brief  Number of handles referencing the buffer, 0 while it is inside the pool.
+     */
+    std::atomic<std::uint32_t> references = 0;
+
+    /**
+     *  \var    next
+     *  \brief  Position of the next free buffer inside the pool.
+     */
+    std::atomic<std::uint16_t> next = 0;
+
+    /**
+     *  \var    pool
+     *  \brief  Pointer to the pool owning the buffer.
+     */
+    BufferPoolBase<Type>* pool = nullptr;
+
+    /**
+     *  \var    value
+     *  \brief  Content of the buffer.
+     */
+    Type value{};
+};
+
+/**
+ *  \class  PooledBuffer
+ *  \brief  The class provides exclusive write access to a buffer freshly taken from a pool.
+ *  \details The emitter fills the buffer and converts it into a SharedBuffer, which is then
+ *          passed by value to the signal. The buffer returns to its pool if it is destroyed
+ *          without being shared.
+ *  \tparam Type passes the buffer's content type.
+ */
+template<class Type>
+class PooledBuffer
+{
+public:
+    /**
+     *  \fn     PooledBuffer(void)
+     *  \brief  The constructor initializes an empty handle.
+     */
+    PooledBuffer(void) = default;
+
+    PooledBuffer(const PooledBuffer&) = delete;
+    PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+    /**
+     *  \fn         PooledBuffer(PooledBuffer&& other)
+     *  \brief      The constructor takes over the buffer of another handle.
+     *  \param[in]  other passes the handle to move.
+     */
+    PooledBuffer(PooledBuffer&& other) :
+            _block(std::exchange(other._block, nullptr))
+    {}
+
+    /**
+     *  \fn         operator=(PooledBuffer&& other)
+     *  \brief      Releases the own buffer and takes over the buffer of another handle.
+     *  \param[in]  other passes the handle to move.
+     *  \return     Reference to the handle.
+     */
+    PooledBuffer& operator=(PooledBuffer&& other)
+    {
+        if (this != &other)
+        {
+            reset();
+            _block = std::exchange(other._block, nullptr);
+        }
+
+        return *this;
+    }
+
+    /**
+     *  \fn     ~PooledBuffer(void)
+     *  \brief  Returns an unshared buffer to its pool.
+     */
+    ~PooledBuffer(void)
+    {
+        reset();
+    }
+
+    /**
+     *  \fn     operator bool(void) const
+     *  \brief  Checks if the handle holds a buffer, which fails if the pool was exhausted.
+     *  \return Boolean indicating result of check.
+     */
+    explicit operator bool(void) const
+    {
+        return _block != nullptr;
+    }
+
+    /**
+     *  \fn     operator*(void) const
+     *  \brief  Accesses the buffer's content.
+     *  \return Reference to the content.
+     */
+    Type& operator*(void) const
+    {
+        return _block->value;
+    }
+
+    /**
+     *  \fn     operator->(void) const
+     *  \brief  Accesses the buffer's content.
+     *  \return Pointer to the content.
+     */
+    Type* operator->(void) const
+    {
+        return &_block->value;
+    }
+
+    /**
+     *  \fn     share(void) &&
+     *  \brief  Publishes the filled buffer for read-only access.
+     *  \return Shared handle of the buffer, empty if the handle was empty.
+     */
+    SharedBuffer<Type> share(void) &&
+    {
+        return SharedBuffer<Type>(std::exchange(_block, nullptr));
+    }
+
+    /**
+     *  \fn     reset(void)
+     *  \brief  Returns the buffer to its pool and empties the handle.
+     */
+    void reset(void)
+    {
+        if (_block)
+        {
+            _block->references.store(0, std::memory_order_relaxed);
+            _block->pool->release(std::exchange(_block, nullptr));
+        }
+    }
+
+private:
+    friend class BufferPoolBase<Type>;
+
+    /**
+     *  \fn         PooledBuffer(BufferBlock<Type>* block)
+     *  \brief      The constructor takes ownership of a buffer taken from a pool.
+     *  \param[in]  block passes a pointer to the buffer.
+     */
+    explicit PooledBuffer(BufferBlock<Type>* block) :
+            _block(block)
+    {}
+
+    /**
+     *  \var    _block
+     *  \brief  Pointer to the buffer or nullptr if the handle is empty.
+     */
+    BufferBlock<Type>* _block = nullptr;
+};
+
+/**
+ *  \class  SharedBuffer
+ *  \brief  The class provides shared read-only access to a pooled buffer.
+ *  \details Copying the handle increments the buffer's reference count instead of copying its
+ *          content, so passing it by value to a signal costs one atomic increment per direct
+ *          slot and per queued call. The buffer returns to its pool once the last handle is
+ *          destroyed, in whatever context that happens. The pool must outlive all handles.
+ *  \tparam Type passes the buffer's content type.
+ */
+template<class Type>
+class SharedBuffer
+{
+public:
+    /**
+     *  \fn     SharedBuffer(void)
+     *  \brief  The constructor initializes an empty handle.
+     */
+    SharedBuffer(void) = default;
+
+    /**
+     *  \fn         SharedBuffer(const SharedBuffer& other)
+     *  \brief      The constructor adds a reference to the buffer of another handle.
+     *  \param[in]  other passes the handle to copy.
+     */
+    SharedBuffer(const SharedBuffer& other) :
+            _block(other._block)
+    {
+        if (_block)
+        {
+            _block->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  \fn         SharedBuffer(SharedBuffer&& other)
+     *  \brief      The constructor takes over the reference of another handle.
+     *  \param[in]  other passes the handle to move.
+     */
+    SharedBuffer(SharedBuffer&& other) :
+            _block(std::exchange(other._block, nullptr))
+    {}
+
+    /**
+     *  \fn         operator=(SharedBuffer other)
+     *  \brief      Replaces the referenced buffer.
+     *  \param[in]  other passes the handle to copy or move.
+     *  \return     Reference to the handle.
+     */
+    SharedBuffer& operator=(SharedBuffer other)
+    {
+        std::swap(_block, other._block);
+
+        return *this;
+    }
+
+    /**
+     *  \fn     ~SharedBuffer(void)
+     *  \brief  Removes the handle's reference and returns an unreferenced buffer to its pool.
+     */
+    ~SharedBuffer(void)
+    {
+        reset();
+    }
+
+    /**
+     *  \fn     operator bool(void) const
+     *  \brief  Checks if the handle references a buffer.
+     *  \return Boolean indicating result of check.
+     */
+    explicit operator bool(void) const
+    {
+        return _block != nullptr;
+    }
+
+    /**
+     *  \fn     operator*(void) const
+     *  \brief  Accesses the buffer's content.
+     *  \return Reference to the content.
+     */
+    const Type& operator*(void) const
+    {
+        return _block->value;
+    }
+
+    /**
+     *  \fn     operator->(void) const
+     *  \brief  Accesses the buffer's content.
+     *  \return Pointer to the content.
+     */
+    const Type* operator->(void) const
+    {
+        return &_block->value;
+    }
+
+    /**
+     *  \fn     references(void) const
+     *  \brief  Returns the number of handles referencing the buffer.
+     *  \note   The number is a snapshot if handles are copied or destroyed concurrently.
+     *  \return Number of handles or 0 if the handle is empty.
+     */
+    std::uint32_t references(void) const
+    {
+        return _block ? _block->references.load(std::memory_order_relaxed) : 0;
+    }
+
+    /**
+     *  \fn     reset(void)
+     *  \brief  Removes the handle's reference and empties the handle.
+     */
+    void reset(void)
+    {
+        BufferBlock<Type>* block = std::exchange(_block, nullptr);
+
+        if (block && block->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            block->pool->release(block);
+        }
+    }
+
+private:
+    friend class PooledBuffer<Type>;
+
+    /**
+     *  \fn         SharedBuffer(BufferBlock<Type>* block)
+     *  \brief      The constructor takes over the reference of a filled buffer.
+     *  \param[in]  block passes a pointer to the buffer or nullptr.
+     */
+    explicit SharedBuffer(BufferBlock<Type>* block) :
+            _block(block)
+    {}
+
+    /**
+     *  \var    _block
+     *  \brief  Pointer to the buffer or nullptr if the handle is empty.
+     */
+    BufferBlock<Type>* _block = nullptr;
+};
+
+/**
+ *  \class  BufferPoolBase
+ *  \brief  The class implements a lock-free free list of buffers.
+ *  \details Buffers can be acquired and released from any context including interrupt
+ *          handlers. The content of an acquired buffer is left as its last user wrote it.
+ *          The storage is provided by the derived BufferPool class.
+ *  \tparam Type passes the buffers' content type.
+ */
+template<class Type>
+class BufferPoolBase
+{
+public:
+    BufferPoolBase(const BufferPoolBase&) = delete;
+    BufferPoolBase& operator=(const BufferPoolBase&) = delete;
+
+    /**
+     *  \fn     acquire(void)
+     *  \brief  Takes a buffer from the pool for exclusive writing.
+     *  \return Handle of the buffer or an empty handle if the pool is exhausted.
+     */
+    PooledBuffer<Type> acquire(void)
+    {
+        std::uint32_t head = _head.load(std::memory_order_acquire);
+
+        while (true)
+        {
+            const std::uint16_t index = static_cast<std::uint16_t>(head);
+
+            if (index == InvalidIndex)
+            {
+                return PooledBuffer<Type>();
+            }
+
+            const std::uint32_t next = ((head & ~Index) + Tag) | _blocks[index].next.load(std::memory_order_relaxed);
+
+            if (_head.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                _available.fetch_sub(1, std::memory_order_relaxed);
+                _blocks[index].references.store(1, std::memory_order_relaxed);
+
+                return PooledBuffer<Type>(&_blocks[index]);
+            }
+        }
+    }
+
+    /**
+     *  \fn     available(void) const
+     *  \brief  Returns the number of buffers inside the pool.
+     *  \return Number of free buffers.
+     */
+    std::size_t available(void) const
+    {
+        return _available.load(std::memory_order_relaxed);
+    }
+
+protected:
+    /**
+     *  \fn         BufferPoolBase(BufferBlock<Type>* blocks, std::size_t count)
+     *  \brief      The constructor links all passed buffers into the free list.
+     *  \param[in]  blocks passes the buffers' memory.
+     *  \param[in]  count passes the number of buffers.
+     */
+    BufferPoolBase(BufferBlock<Type>* blocks, std::size_t count) :
+            _blocks(blocks),
+            _head(count ? 0 : InvalidIndex),
+            _available(count)
+    {
+        for (std::size_t index = 0; index < count; index++)
+        {
+            _blocks[index].pool = this;
+            _blocks[index].next.store(index + 1 < count ? static_cast<std::uint16_t>(index + 1) : InvalidIndex,
+                                      std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  \var    InvalidIndex
+     *  \brief  Position marking the end of the free list.
+     */
+    static constexpr std::uint16_t InvalidIndex = UINT16_MAX;
+
+private:
+    friend class PooledBuffer<Type>;
+    friend class SharedBuffer<Type>;
+
+    /**
+     *  \var    Index
+     *  \brief  Mask of the first free position inside the free list's head.
+     */
+    static constexpr std::uint32_t Index = 0xFFFF;
+
+    /**
+     *  \var    Tag
+     *  \brief  Increment of the head's tag, which protects the list against reuse races.
+     */
+    static constexpr std::uint32_t Tag = 0x10000;
+
+    /**
+     *  \fn         release(BufferBlock<Type>* block)
+     *  \brief      Returns an unreferenced buffer to the free list.
+     *  \param[in]  block passes a pointer to the buffer.
+     */
+    void release(BufferBlock<Type>* block)
+    {
+        const std::uint16_t index = static_cast<std::uint16_t>(block - _blocks);
+        std::uint32_t head = _head.load(std::memory_order_relaxed);
+
+        do
+        {
+            block->next.store(static_cast<std::uint16_t>(head), std::memory_order_relaxed);
+        }
+        while (!_head.compare_exchange_weak(head, ((head & ~Index) + Tag) | index,
+                                            std::memory_order_release, std::memory_order_relaxed));
+
+        _available.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     *  \var    _blocks
+     *  \brief  Pointer to the buffers' memory.
+     */
+    BufferBlock<Type>* _blocks;
+
+    /**
+     *  \var    _head
+     *  \brief  Tag and position of the first free buffer.
+     */
+    std::atomic<std::uint32_t> _head;
+
+    /**
+     *  \var    _available
+     *  \brief  Number of buffers inside the pool.
+     */
+    std::atomic<std::size_t> _available;
+};
+
+/**
+ *  \struct BufferPoolStorage
+ *  \brief  The struct holds the buffers of a pool.
+ *  \tparam Type passes the buffers' content type.
+ *  \tparam Count passes the number of buffers.
+ */
+template<class Type, std::size_t Count>
+struct BufferPoolStorage
+{
+    /**
+     *  \var    blocks
+     *  \brief  Buffers of the pool.
+     */
+    BufferBlock<Type> blocks[Count];
+};
+
+/**
+ *  \class  BufferPool
+ *  \brief  The class provides the statically allocated buffers of a pool.
+ *  \details A pool lets large payloads such as CAN-FD frames or sensor blocks pass through
+ *          signals without copies: the emitter acquires and fills a buffer, then emits it as
+ *          SharedBuffer<Type>. Every direct slot and every queued call receives a reference.
+ *  \tparam Type passes the buffers' content type.
+ *  \tparam Count passes the number of buffers.
+ */
+template<class Type, std::size_t Count>
+class BufferPool :
+        private BufferPoolStorage<Type, Count>,
+        public BufferPoolBase<Type>
+{
+    static_assert(Count > 0 && Count < BufferPoolBase<Type>::InvalidIndex, "Invalid buffer count.");
+
+public:
+    /**
+     *  \fn     BufferPool(void)
+     *  \brief  The constructor initializes a pool with all buffers available.
+     */
+    BufferPool(void) :
+            BufferPoolBase<Type>(this->blocks, Count)
+    {}
+};
+
+#endif //BUFFER_POOL_HPP
\ No newline at end of file
@@ -0,0 +1,117 @@
+/**
+ *  \file   clock.hpp
+ *  \brief  The file implements the clocks measuring slot latencies and connection lifetimes.
+ *  \note   Define EMBEDDED_SIGNALS_CLOCK or EMBEDDED_SIGNALS_DEADLINE_CLOCK to supply own clocks.
+ */
+
+#ifndef CLOCK_HPP
+#define CLOCK_HPP
+
+#include <cstdint>
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+
+/**
+ *  \struct DwtClock
+ *  \brief  The struct reads the DWT cycle counter of a Cortex-M core.
+ */
+struct DwtClock
+{
+    /**
+     *  \fn     enable(void)
+     *  \brief  Starts the cycle counter.
+     */
+    static void enable(void)
+    {
+        *reinterpret_cast<volatile std::uint32_t*>(0xE000EDFC) |= 1u << 24;
+        *reinterpret_cast<volatile std::uint32_t*>(0xE0001000) |= 1u << 0;
+    }
+
+    /**
+     *  \fn     now(void)
+     *  \brief  Reads the cycle counter.
+     *  \return Current number of cycles.
+     */
+    static std::uint32_t now(void)
+    {
+        return *reinterpret_cast<volatile std::uint32_t*>(0xE0001004);
+    }
+};
+
+#ifndef EMBEDDED_SIGNALS_CLOCK
+/**
+ *  \def    EMBEDDED_SIGNALS_CLOCK
+ *  \brief  Type providing a static now() function returning 32 bit clock ticks.
+ */
+#define EMBEDDED_SIGNALS_CLOCK DwtClock
+#endif
+
+#ifndef EMBEDDED_SIGNALS_DEADLINE_CLOCK
+/**
+ *  \def    EMBEDDED_SIGNALS_DEADLINE_CLOCK
+ *  \brief  Type providing a static now() function returning the 32 bit ticks of connection lifetimes.
+ *  \note   Lifetimes are limited to 2^31 ticks, override the clock with a tick counter
+ *          such as a millisecond SysTick for longer lifetimes.
+ */
+#define EMBEDDED_SIGNALS_DEADLINE_CLOCK DwtClock
+#endif
+
+#else
+
+#include <chrono>
+
+/**
+ *  \struct SteadyClock
+ *  \brief  The struct reads the steady clock of the standard library in nanoseconds.
+ */
+struct SteadyClock
+{
+    /**
+     *  \fn     now(void)
+     *  \brief  Reads the clock.
+     *  \return Current time in nanoseconds, truncated to 32 bits.
+     */
+    static std::uint32_t now(void)
+    {
+        return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+/**
+ *  \struct MillisecondClock
+ *  \brief  The struct reads the steady clock of the standard library in milliseconds.
+ */
+struct MillisecondClock
+{
+    /**
+     *  \fn     now(void)
+     *  \brief  Reads the clock.
+     *  \return Current time in milliseconds, truncated to 32 bits.
+     */
+    static std::uint32_t now(void)
+    {
+        return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+#ifndef EMBEDDED_SIGNALS_CLOCK
+/**
+ *  \def    EMBEDDED_SIGNALS_CLOCK
+ *  \brief  Type providing a static now() function returning 32 bit clock ticks.
+ */
+#define EMBEDDED_SIGNALS_CLOCK SteadyClock
+#endif
+
+#ifndef EMBEDDED_SIGNALS_DEADLINE_CLOCK
+/**
+ *  \def    EMBEDDED_SIGNALS_DEADLINE_CLOCK
+ *  \brief  Type providing a static now() function returning the 32 bit ticks of connection lifetimes.
+ */
+#define EMBEDDED_SIGNALS_DEADLINE_CLOCK MillisecondClock
+#endif
+
+#endif
+
+#endif //CLOCK_HPP
\ No newline at end of file
@@ -6,7 +6,29 @@
 #ifndef CONNECTION_HPP
 #define CONNECTION_HPP
 
-#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "argument.hpp"
+#include "batch.hpp"
+#include "delegate.hpp"
+#include "deliveryPolicy.hpp"
+#include "eventQueue.hpp"
+
+#ifndef EMBEDDED_SIGNALS_INLINE
+#if !defined(EMBEDDED_SIGNALS_COMPACT) && (defined(__GNUC__) || defined(__clang__))
+/**
+ *  \def    EMBEDDED_SIGNALS_INLINE
+ *  \brief  Attribute keeping the per slot steps inside the emit loop unless code size is optimized.
+ */
+#define EMBEDDED_SIGNALS_INLINE [[gnu::always_inline]]
+#else
+#define EMBEDDED_SIGNALS_INLINE
+#endif
+#endif
 
 /**
  *  \concept    isDerived
@@ -17,11 +39,88 @@
 template<class Base, class Derived>
 concept isDerived = std::is_base_of<Base, Derived>::value;
 
-class SignalObject;
+/**
+ *  \enum   ConnectionType
+ *  \brief  The enum describes when a connected slot is executed.
+ */
+enum class ConnectionType : std::uint8_t
+{
+    Direct,
+    Queued
+};
+
+/**
+ *  \typedef    ConnectionPriority
+ *  \brief      Type ordering the slots of a signal, slots of higher priority are called first.
+ *  \note       Slots of equal priority are called in the order they were connected.
+ */
+using ConnectionPriority = std::int8_t;
+
+/**
+ *  \struct ConnectionExpiry
+ *  \brief  The struct describes when a connection removes itself.
+ *  \note   A connection expires after its number of shots or once its lifetime has passed,
+ *          whichever comes first. A batch counts as a single shot.
+ */
+struct ConnectionExpiry
+{
+    /**
+     *  \var    MaxShots
+     *  \brief  Maximum number of shots of a connection.
+     */
+    static constexpr std::uint16_t MaxShots = 0x7FFE;
+
+    /**
+     *  \var    shots
+     *  \brief  Number of slot calls before the connection expires or 0 for no limit.
+     */
+    std::uint16_t shots = 0;
+
+    /**
+     *  \var    lifetime
+     *  \brief  Ticks of EMBEDDED_SIGNALS_DEADLINE_CLOCK before the connection expires or 0 for
+     *          no limit, lifetimes must be less than 2^31 ticks.
+     */
+    std::uint32_t lifetime = 0;
+
+    /**
+     *  \fn     singleShot(void)
+     *  \brief  Describes a connection removed after its first slot call.
+     *  \return Expiry of a single shot connection.
+     */
+    static constexpr ConnectionExpiry singleShot(void)
+    {
+        return ConnectionExpiry{1, 0};
+    }
+
+    /**
+     *  \fn         afterShots(std::uint16_t shots)
+     *  \brief      Describes a connection removed after a number of slot calls.
+     *  \param[in]  shots passes the number of slot calls up to MaxShots.
+     *  \return     Expiry of the connection.
+     */
+    static constexpr ConnectionExpiry afterShots(std::uint16_t shots)
+    {
+        return ConnectionExpiry{shots, 0};
+    }
+
+    /**
+     *  \fn         afterTicks(std::uint32_t lifetime)
+     *  \brief      Describes a connection removed once its lifetime has passed.
+     *  \param[in]  lifetime passes the lifetime in deadline clock ticks.
+     *  \return     Expiry of the connection.
+     */
+    static constexpr ConnectionExpiry afterTicks(std::uint32_t lifetime)
+    {
+        return ConnectionExpiry{0, lifetime};
+    }
+};
 
 /**
  *  \class  Connection
- *  \brief  The class represents a connection between signal and slot.
+ *  \brief  The class represents the dispatch payload of a connection between signal and slot.
+ *  \note   The key of the sender's signal and the receiver are stored apart by the connection
+ *          pool, so an emit only touches the data required to call the slot.
  *  \tparam ParamPack passes the signal's and slot's parameter pack.
  */
 template<class... ParamPack>
@@ -29,111 +128,156 @@ class Connection
 {
 public:
     /**
-     *  \fn         Connection()
+     *  \fn         Connection(void)
+     *  \brief      The constructor initializes an unused instance.
+     */
+    Connection(void) = default;
+
+    /**
+     *  \fn         Connection(const Delegate<ParamPack...>& slot, EventQueueBase* queue, DeliveryPolicy<ParamPack...>* policy)
      *  \brief      The constructor initializes the instance.
-     *  \tparam     Sender passes the sender's typename.
-     *  \tparam     Receiver passes the receiver's typename.
-     *  \tparam     SenderBase passes the signal's implementaion class.
-     *  \tparam     ReceiveBase passes the slot's implementation class.
-     *  \param[in]  sender passes a pointer to the sender instance.
-     *  \param[in]  receiver passes a pointer to the receiver instance.
-     *  \param[in]  signal passes method to connect as signal.
-     *  \param[in]  slot passes the method to connect as slot.
-     */
-    template<class Sender, class Receiver, class SenderBase, class ReceiverBase>
-    requires isDerived<SenderBase, Sender> && isDerived<ReceiverBase, Receiver>
-    Connection(Sender* sender,
-               Receiver* receiver,
-               void(SenderBase::*signal)(ParamPack...),
-               void(ReceiverBase::*slot)(ParamPack...)
+     *  \param[in]  slot passes the callable to connect as slot.
+     *  \param[in]  queue passes the queue of a queued connection or nullptr for a direct one.
+     *  \param[in]  policy passes the policy filtering the connection's emits or nullptr.
+     */
+    Connection(const Delegate<ParamPack...>& slot,
+               EventQueueBase* queue = nullptr,
+               DeliveryPolicy<ParamPack...>* policy = nullptr
     ) :
-            _sender(static_cast<SignalObject*>(sender)),
-            _receiver(static_cast<SignalObject*>(receiver)),
-            _signal(static_cast<void(SignalObject::*)(ParamPack...)>(signal)),
-            _slot(static_cast<void(SignalObject::*)(ParamPack...)>(slot))
+            _slot(slot),
+            _queue(queue),
+            _policy(policy)
     {}
 
     /**
-     *  \fn         fireSlot(ParamPack... args)
-     *  \brief      Calls the receivers slot.
+     *  \fn         fireSlot(Argument<ParamPack>... args)
+     *  \brief      Calls the receivers slot or queues the call for a queued connection.
+     *  \note       Value arguments are moved into the slot or into the queued call. The
+     *              delivery policy is evaluated first, so dropped emits are never queued.
      *  \param[in]  args passes the slot's argument list.
      */
-    void fireSlot(ParamPack... args)
+    EMBEDDED_SIGNALS_INLINE void fireSlot(Argument<ParamPack>... args)
     {
-        if (_receiver && _slot)
+        if (!_slot || (_policy && !_policy->admit(_slot, _queue, args...)))
         {
-            (*_receiver.*_slot)(args...);
+            return;
         }
-    }
 
-    /**
-     *  \fn         isSender(const SignalObject* sender) const
-     *  \brief      Checks if passed instance is connection's sender.
-     *  \param[in]  sender passes a pointer to the instance to check.
-     *  \return     Boolean indicating result of check.
-     */ 
-    bool isSender(const SignalObject* sender) const
-    {
-        return sender == _sender;
+        if (_queue)
+        {
+            _queue->post(QueuedCall{_slot, {std::forward<ParamPack>(args)...}});
+        }
+        else
+        {
+            _slot(std::forward<ParamPack>(args)...);
+        }
     }
 
     /**
-     *  \fn         isReceiver(const SignalObject* receiver) const
-     *  \brief      Checks if passed instance is connection's receiver.
-     *  \param[in]  receiver passes a pointer to the instance to check.
-     *  \return     Boolean indicating result of check.
+     *  \fn         fireBatch(Batch<ParamPack...> batch)
+     *  \brief      Calls the receivers slot for all argument sets of a batch.
+     *  \note       A queued connection posts one call per argument set. A connection with a
+     *              delivery policy evaluates it per argument set.
+     *  \param[in]  batch passes the argument sets.
      */
-    bool isReceiver(const SignalObject* receiver) const
+    void fireBatch(Batch<ParamPack...> batch)
+    requires isBatchable<ParamPack...>
     {
-        return receiver == _receiver;
+        if (!_slot)
+        {
+            return;
+        }
+
+        if (_policy)
+        {
+            auto deliver = [this](Argument<ParamPack>... args) { fireSlot(std::forward<ParamPack>(args)...); };
+
+            for (const BatchElement<ParamPack...>& element : batch)
+            {
+                BatchTraits<ParamPack...>::invoke(deliver, element);
+            }
+        }
+        else if (_queue)
+        {
+            for (const BatchElement<ParamPack...>& element : batch)
+            {
+                _queue->post(QueuedCall{_slot, std::tuple<std::decay_t<ParamPack>...>(element)});
+            }
+        }
+        else
+        {
+            _slot.callBatch(batch);
+        }
     }
 
     /**
-     *  \fn         isSignal(void(SignalObject::*signal)(ParamPack...)) const
-     *  \brief      Checks if passed method pointer is connection's signal.
-     *  \param[in]  signal passes a method pointer to check.
-     *  \return     Boolean indicating result of check.
+     *  \fn         queuedEventSize(void)
+     *  \brief      Returns the storage a queued call of the connection takes inside a queue.
+     *  \return     Size of a queued call in bytes.
      */
-    bool isSignal(void(SignalObject::*signal)(ParamPack...)) const
+    static constexpr std::size_t queuedEventSize(void)
     {
-        return signal == _signal;
+        return sizeof(QueuedCall);
     }
 
     /**
-     *  \fn         isSlot(void(SignalObject::*slot)(ParamPack...)) const
-     *  \brief      Checks if passed method pointer is connection's slot.
-     *  \param[in]  slot passes a method pointer to check.
+     *  \fn         isSlot(const Delegate<ParamPack...>& slot) const
+     *  \brief      Checks if passed callable is connection's slot.
+     *  \param[in]  slot passes the callable to check.
      *  \return     Boolean indicating result of check.
      */
-    bool isSlot(void(SignalObject::*slot)(ParamPack...)) const
+    bool isSlot(const Delegate<ParamPack...>& slot) const
     {
         return slot == _slot;
     }
 
 private:
     /**
-     *  \var    _sender
-     *  \brief  Pointer to connection's sender instance.
+     *  \struct QueuedCall
+     *  \brief  The struct stores a deferred slot call including copies of its arguments.
      */
-    SignalObject* _sender;
+    struct QueuedCall
+    {
+        /**
+         *  \var    slot
+         *  \brief  Callable of the receiver's slot.
+         */
+        Delegate<ParamPack...> slot;
+
+        /**
+         *  \var    args
+         *  \brief  Copies of the signal's arguments.
+         */
+        std::tuple<std::decay_t<ParamPack>...> args;
+
+        /**
+         *  \fn     operator()(void)
+         *  \brief  Calls the receiver's slot by moving the stored arguments into it.
+         *  \note   Reference parameters refer to the stored copies.
+         */
+        void operator()(void)
+        {
+            std::apply([this](auto&... values) { slot(passArgument<ParamPack, true>(values)...); }, args);
+        }
+    };
 
     /**
-     *  \var    _receiver
-     *  \brief  Pointer to connection's receiver instance.
+     *  \var    _slot
+     *  \brief  Callable of the connection's slot.
      */
-    SignalObject* _receiver;
+    Delegate<ParamPack...> _slot;
 
     /**
-     *  \var    _signal
-     *  \brief  Method pointer to the connection's signal.
+     *  \var    _queue
+     *  \brief  Pointer to the queue of a queued connection or nullptr for a direct one.
      */
-    void(SignalObject::*_signal)(ParamPack...);
-    
+    EventQueueBase* _queue = nullptr;
+
     /**
-     *  \var    _slot
-     *  \brief  Method pointer to the connection's slot.
+     *  \var    _policy
+     *  \brief  Pointer to the policy filtering the connection's emits or nullptr.
      */
-    void(SignalObject::*_slot)(ParamPack...);
+    DeliveryPolicy<ParamPack...>* _policy = nullptr;
 };
 
 #endif //CONNECTION_HPP
\ No newline at end of file
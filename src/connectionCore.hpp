@@ -0,0 +1,1905 @@
+/**
+ *  \file   connectionCore.hpp
+ *  \brief  The file implements the signature independent storage and matching of connections.
+ */
+
+#ifndef CONNECTION_CORE_HPP
+#define CONNECTION_CORE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "clock.hpp"
+#include "connection.hpp"
+#include "connectionGroup.hpp"
+#include "connectionHandle.hpp"
+#include "connectionLink.hpp"
+#include "footprint.hpp"
+#include "signalAwaiter.hpp"
+#include "signalKey.hpp"
+#include "wiring.hpp"
+
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+#include "instrumentation.hpp"
+#endif
+
+#ifndef EMBEDDED_SIGNALS_OUTLINE
+#if defined(EMBEDDED_SIGNALS_COMPACT) && (defined(__GNUC__) || defined(__clang__))
+/**
+ *  \def    EMBEDDED_SIGNALS_OUTLINE
+ *  \brief  Attribute keeping the core functions out of line in the code size optimized mode.
+ */
+#define EMBEDDED_SIGNALS_OUTLINE [[gnu::noinline]]
+#else
+#define EMBEDDED_SIGNALS_OUTLINE
+#endif
+#endif
+
+#ifndef EMBEDDED_SIGNALS_FORWARD_DEPTH
+/**
+ *  \def    EMBEDDED_SIGNALS_FORWARD_DEPTH
+ *  \brief  Maximum number of forwarding connections an emit passes behind each other.
+ */
+#define EMBEDDED_SIGNALS_FORWARD_DEPTH 4
+#endif
+
+/**
+ *  \class  ConnectionCore
+ *  \brief  The class stores the connection lists of all signatures sharing a capacity.
+ *  \details The core holds everything but the typed dispatch payloads: the signal index,
+ *          the list links, the expiry and epoch states and the object links. Signatures
+ *          with equal capacities share the core's code and thereby only instantiate a thin
+ *          typed layer each.
+ *          Emission is lock-free and may run concurrently to a single modifying context,
+ *          e.g. emits from interrupt handlers while the main loop connects and disconnects.
+ *          Connections are published with release stores, and removed connections are
+ *          only reused once no emission is in flight anymore.
+ *          Expiring connections are claimed by a single compare and swap per call. The emit
+ *          consuming the last shot pushes the connection onto a lock-free list, which the
+ *          modifying context drains on its next connect or disconnect while no emission is
+ *          in flight.
+ *          Slots may connect and disconnect while their signal is emitted. Removed connections
+ *          are not called anymore, their storage is reclaimed once the emission count, which
+ *          doubles as nesting depth, drops to zero. Connections made while an emission is in
+ *          flight are stamped with an epoch and skipped by the emits already in progress.
+ *          Forwarding connections link a signal to the list of another signal of the core.
+ *          They are resolved to the target's index entry when connected, so an emit walks
+ *          the whole chain in a single pass without looking up the forwarded signals.
+ *          Connections inside a ConnectionGroup carry a flag taking the slow path of the
+ *          claim, which checks the group's enable flag, so others pay nothing for groups.
+ *          Blocked connections carry a flag as well and are filtered by the same single
+ *          comparison of the state every emit does anyway.
+ *          While the Wiring is frozen, every modification but the removal by a destroyed
+ *          object or group is refused, so the index and lists stay as they are.
+ *  \tparam Capacity passes the number of connections.
+ *  \tparam TableSize passes the number of signal index entries, which must be a power of two.
+ */
+template<std::size_t Capacity, std::size_t TableSize>
+class ConnectionCore
+{
+public:
+    /**
+     *  \typedef    Index
+     *  \brief      Type used to address a connection inside the core.
+     */
+    using Index = ConnectionIndex;
+
+    /**
+     *  \var    InvalidIndex
+     *  \brief  Index marking the end of a connection list.
+     */
+    static constexpr Index InvalidIndex = ConnectionHandle<>::InvalidIndex;
+
+    static_assert(Capacity > 0 && Capacity < InvalidIndex, "Invalid connection capacity.");
+    static_assert(std::has_single_bit(TableSize) && TableSize < InvalidIndex, "Invalid signal capacity.");
+
+    /**
+     *  \var    GroupSlots
+     *  \brief  Number of group states and links, a single unused one if groups are disabled.
+     */
+    static constexpr std::size_t GroupSlots = ConnectionGroup::Capacity > 0 ? Capacity : 1;
+
+    ConnectionCore(void) = default;
+    ConnectionCore(const ConnectionCore&) = delete;
+    ConnectionCore& operator=(const ConnectionCore&) = delete;
+
+    /**
+     *  \fn         control(ConnectionLink* link, LinkAction action)
+     *  \brief      Removes or blocks the connection owning a sender, receiver or group link in
+     *              constant time.
+     *  \note       Only receiver links block their connection, so an object blocking its slots
+     *              leaves the connections of its own signals alone.
+     *  \param[in]  link passes a pointer to one of the connection's links.
+     *  \param[in]  action passes what to apply to the connection.
+     */
+    EMBEDDED_SIGNALS_OUTLINE void control(ConnectionLink* link, LinkAction action)
+    {
+        const bool receiver = link >= _receiverLinks && link < _receiverLinks + Capacity;
+        const ConnectionLink* links = link >= _senderLinks && link < _senderLinks + Capacity ? _senderLinks :
+                                      receiver ? _receiverLinks : _groupLinks;
+        const Index index = static_cast<Index>(link - links);
+
+        if (action == LinkAction::Remove)
+        {
+            erase(index);
+        }
+        else if (receiver)
+        {
+            updateBlock(index, ReceiverBlock, action == LinkAction::Block);
+        }
+    }
+
+    /**
+     *  \fn         cancel(SignalWaiterBase* waiter)
+     *  \brief      Removes a waiter from its signal's waiter list in constant time.
+     *  \param[in]  waiter passes a pointer to the waiter, which may already be unlinked.
+     */
+    EMBEDDED_SIGNALS_OUTLINE void cancel(SignalWaiterBase* waiter)
+    {
+        if (waiter->entry == InvalidIndex)
+        {
+            return;
+        }
+
+        SignalEntry* entry = &_signals[waiter->entry];
+
+        if (entry->waiters == waiter)
+        {
+            entry->waiters = waiter->next;
+        }
+        else
+        {
+            waiter->previous->next = waiter->next;
+        }
+
+        if (waiter->next)
+        {
+            waiter->next->previous = waiter->previous;
+        }
+        else if (entry->waiters)
+        {
+            entry->waiters->previous = waiter->previous;
+        }
+
+        waiter->entry = InvalidIndex;
+        _waiting.store(_waiting.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+        if (unused(entry))
+        {
+            release(entry);
+        }
+    }
+
+    /**
+     *  \fn     waiting(void) const
+     *  \brief  Checks if any coroutine waits for a signal of the core.
+     *  \return Boolean indicating result of check.
+     */
+    bool waiting(void) const
+    {
+        return _waiting.load(std::memory_order_relaxed) != 0;
+    }
+
+protected:
+    /**
+     *  \enum   EntryState
+     *  \brief  The enum describes the state of a signal index entry.
+     */
+    enum class EntryState : std::uint8_t
+    {
+        Empty,
+        Used,
+        Removed
+    };
+
+    /**
+     *  \var    Unlimited
+     *  \brief  Limit of a connection that never expires.
+     */
+    static constexpr std::uint32_t Unlimited = 0;
+
+    /**
+     *  \var    Shots
+     *  \brief  Mask of the remaining shots inside a limit.
+     */
+    static constexpr std::uint32_t Shots = 0x7FFF;
+
+    /**
+     *  \var    Timed
+     *  \brief  Flag of a limit marking a connection with a deadline.
+     */
+    static constexpr std::uint32_t Timed = 0x8000;
+
+    /**
+     *  \var    Expired
+     *  \brief  Limit of an expired connection waiting for removal.
+     */
+    static constexpr std::uint32_t Expired = 0xFFFF;
+
+    /**
+     *  \var    Limit
+     *  \brief  Mask of the limit inside a connection's state, the upper bits hold its epoch and flags.
+     */
+    static constexpr std::uint32_t Limit = 0xFFFF;
+
+    /**
+     *  \var    Births
+     *  \brief  Position of the connect epoch inside a connection's state.
+     */
+    static constexpr unsigned Births = 16;
+
+    /**
+     *  \var    Newest
+     *  \brief  Connect epoch at which the epoch saturates.
+     */
+    static constexpr std::uint16_t Newest = 0x1FFF;
+
+    /**
+     *  \var    Forwarding
+     *  \brief  Flag of a connection's state marking a forwarding connection, above its epoch.
+     */
+    static constexpr std::uint32_t Forwarding = 0x80000000;
+
+    /**
+     *  \var    Grouped
+     *  \brief  Flag of a connection's state marking a member of a group, above its epoch.
+     */
+    static constexpr std::uint32_t Grouped = 0x40000000;
+
+    /**
+     *  \var    Blocked
+     *  \brief  Flag of a connection's state marking a connection blocked for any reason.
+     */
+    static constexpr std::uint32_t Blocked = 0x20000000;
+
+    /**
+     *  \var    Flags
+     *  \brief  Mask of the flags of a connection's state kept when its epoch is reset.
+     */
+    static constexpr std::uint32_t Flags = Forwarding | Grouped | Blocked;
+
+    /**
+     *  \var    HandleBlock
+     *  \brief  Reason of a connection blocked by its handle.
+     */
+    static constexpr std::uint8_t HandleBlock = 0x01;
+
+    /**
+     *  \var    ReceiverBlock
+     *  \brief  Reason of a connection blocked by its receiver.
+     */
+    static constexpr std::uint8_t ReceiverBlock = 0x02;
+
+    /**
+     *  \var    Settle
+     *  \brief  Connect epoch from which an idle pool resets the epochs of its connections.
+     */
+    static constexpr std::uint16_t Settle = 0x1000;
+
+    /**
+     *  \var    ForwardDepth
+     *  \brief  Maximum number of forwarding connections an emit passes behind each other.
+     */
+    static constexpr std::size_t ForwardDepth = EMBEDDED_SIGNALS_FORWARD_DEPTH;
+
+    static_assert(ForwardDepth > 0, "Invalid forwarding depth.");
+
+    static_assert(std::atomic<Index>::is_always_lock_free, "Connection links must be lock-free.");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Connection states must be lock-free.");
+
+    /**
+     *  \struct SignalEntry
+     *  \brief  The struct maps a sender's signal to its connection list.
+     */
+    struct SignalEntry
+    {
+        /**
+         *  \var    key
+         *  \brief  Identifier of the sender's signal.
+         */
+        SignalId key{};
+
+        /**
+         *  \var    head
+         *  \brief  Index of the first connection of the signal.
+         */
+        std::atomic<Index> head = InvalidIndex;
+
+        /**
+         *  \var    tail
+         *  \brief  Index of the last connection of the signal.
+         */
+        Index tail = InvalidIndex;
+
+        /**
+         *  \var    state
+         *  \brief  State of the entry.
+         */
+        std::atomic<EntryState> state = EntryState::Empty;
+
+        /**
+         *  \var    forwarders
+         *  \brief  Number of forwarding connections targeting the signal.
+         */
+        Index forwarders = 0;
+
+        /**
+         *  \var    waiters
+         *  \brief  Pointer to the first coroutine waiting for the signal.
+         */
+        SignalWaiterBase* waiters = nullptr;
+
+        /**
+         *  \var    summary
+         *  \brief  Pointer to the connection summary of the sender.
+         */
+        SignalSummary* summary = nullptr;
+
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+        /**
+         *  \var    emits
+         *  \brief  Number of emits of the signal.
+         */
+        std::atomic<std::uint32_t> emits = 0;
+
+        /**
+         *  \var    worst
+         *  \brief  Clock ticks of the signal's longest emit.
+         */
+        std::atomic<std::uint32_t> worst = 0;
+#endif
+    };
+
+    /**
+     *  \struct DispatchTarget
+     *  \brief  The struct passes the typed steps of an emit to the out of line dispatch loop.
+     */
+    struct DispatchTarget
+    {
+        /**
+         *  \var    context
+         *  \brief  Pointer to the typed emit's state.
+         */
+        void* context;
+
+        /**
+         *  \var    capture
+         *  \brief  Function storing the emitted arguments inside a waiter.
+         */
+        void (*capture)(void* context, SignalWaiterBase* waiter);
+
+        /**
+         *  \var    fire
+         *  \brief  Function calling the slot of a connection, last marks the list's final one.
+         */
+        void (*fire)(void* context, Index index, bool last);
+    };
+
+    /**
+     *  \struct Unjoined
+     *  \brief  The struct completes an emit that calls all slots from the dispatch loop itself.
+     */
+    struct Unjoined
+    {
+        /**
+         *  \fn     operator()(void) const
+         *  \brief  Does nothing.
+         */
+        void operator()(void) const
+        {}
+    };
+
+    /**
+     *  \fn         prepare(const SignalId& key, const ConnectionExpiry& expiry, Index& index)
+     *  \brief      Takes a connection from the pool and finds or creates its signal's entry.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \param[in]  expiry passes when the connection removes itself.
+     *  \param[out] index returns the index of the taken connection.
+     *  \return     Pointer to the signal's entry or nullptr if the pool or the index is full or
+     *              the wiring is frozen.
+     */
+    EMBEDDED_SIGNALS_OUTLINE SignalEntry* prepare(const SignalId& key, const ConnectionExpiry& expiry, Index& index)
+    {
+        if (!Wiring::permits())
+        {
+            return nullptr;
+        }
+
+        reclaim();
+
+        if (expiry.shots > ConnectionExpiry::MaxShots)
+        {
+            return nullptr;
+        }
+
+        SignalEntry* entry = findOrCreate(key);
+
+        if (!entry)
+        {
+            return nullptr;
+        }
+
+        index = allocate();
+
+        if (index == InvalidIndex)
+        {
+            if (unused(entry))
+            {
+                release(entry);
+            }
+
+            return nullptr;
+        }
+
+        return entry;
+    }
+
+    /**
+     *  \fn         prepareForward(const SignalId& key, const SignalId& target, const ConnectionExpiry& expiry, Index& index)
+     *  \brief      Takes a connection from the pool forwarding a signal to another one.
+     *  \note       Chains longer than EMBEDDED_SIGNALS_FORWARD_DEPTH, cycles and a second
+     *              forward between the same signals are rejected, which bounds the walk of
+     *              every emit.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \param[in]  target passes the identifier of the forwarded signal.
+     *  \param[in]  expiry passes when the connection removes itself.
+     *  \param[out] index returns the index of the taken connection.
+     *  \return     Pointer to the signal's entry or nullptr if the connection is not possible.
+     */
+    EMBEDDED_SIGNALS_OUTLINE SignalEntry* prepareForward(const SignalId& key,
+                                                         const SignalId& target,
+                                                         const ConnectionExpiry& expiry,
+                                                         Index& index
+    )
+    {
+        SignalEntry* entry = prepare(key, expiry, index);
+
+        if (!entry)
+        {
+            return nullptr;
+        }
+
+        SignalEntry* forward = findOrCreate(target);
+
+        if (!forward ||
+            forwardsTo(entry, forward) ||
+            depthAbove(entry) + 1 + depthBelow(forward, entry) > ForwardDepth)
+        {
+            if (forward && unused(forward))
+            {
+                release(forward);
+            }
+
+            if (unused(entry))
+            {
+                release(entry);
+            }
+
+            _chain[index] = _free;
+            _free = index;
+
+            return nullptr;
+        }
+
+        forward->forwarders++;
+        _forwards[index] = static_cast<Index>(forward - _signals);
+
+        return entry;
+    }
+
+    /**
+     *  \fn         link()
+     *  \brief      Publishes a prepared connection behind all connections of its signal with
+     *              equal or higher priority.
+     *  \note       The list is kept ordered on insertion, so emits never sort. Appending a
+     *              connection of the lowest priority so far takes constant time.
+     *  \param[in]  entry passes a pointer to the signal's entry.
+     *  \param[in]  index passes the index of the prepared connection.
+     *  \param[in]  receiver passes a pointer to the receiver instance or nullptr if there is none.
+     *  \param[in]  priority passes the connection's priority, higher priorities are called first.
+     *  \param[in]  expiry passes when the connection removes itself.
+     *  \param[in]  senderList passes the connection list of the sender instance.
+     *  \param[in]  summary passes the connection summary of the sender instance.
+     *  \param[in]  receiverList passes the connection list of the receiver instance or nullptr.
+     *  \param[in]  blocked passes whether the receiver's slots are blocked.
+     *  \param[in]  handler passes the function removing or blocking a connection by one of its links.
+     *  \return     Handle of the connection.
+     */
+    EMBEDDED_SIGNALS_OUTLINE ConnectionHandle<> link(SignalEntry* entry,
+                                                     Index index,
+                                                     const SignalObject* receiver,
+                                                     ConnectionPriority priority,
+                                                     const ConnectionExpiry& expiry,
+                                                     ConnectionList& senderList,
+                                                     SignalSummary& summary,
+                                                     ConnectionList* receiverList,
+                                                     bool blocked,
+                                                     void (*handler)(ConnectionLink* link, LinkAction action)
+    )
+    {
+        const bool first = entry->head.load(std::memory_order_relaxed) == InvalidIndex;
+        Index previous = entry->tail;
+
+        while (previous != InvalidIndex && _priorities[previous] < priority)
+        {
+            previous = _previous[previous];
+        }
+
+        const Index next = previous == InvalidIndex ? entry->head.load(std::memory_order_relaxed) :
+                                                      _next[previous].load(std::memory_order_relaxed);
+
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+        Instrumentation::attach(_source);
+        _statistics[index].reset();
+#endif
+
+        _live++;
+        _peak = std::max(_peak, _live);
+        _receivers[index] = receiver;
+        _entries[index] = static_cast<Index>(entry - _signals);
+        _priorities[index] = priority;
+        _deadlines[index] = EMBEDDED_SIGNALS_DEADLINE_CLOCK::now() + expiry.lifetime;
+        _blocks[index] = blocked ? ReceiverBlock : 0;
+        _limits[index].store(static_cast<std::uint32_t>(stamp()) << Births |
+                             expiry.shots | (expiry.lifetime ? Timed : Unlimited) |
+                             (_forwards[index] != InvalidIndex ? Forwarding : Unlimited) |
+                             (blocked ? Blocked : Unlimited),
+                             std::memory_order_relaxed);
+        _next[index].store(next, std::memory_order_relaxed);
+        _previous[index] = previous;
+
+        if (next == InvalidIndex)
+        {
+            entry->tail = index;
+        }
+        else
+        {
+            _previous[next] = index;
+        }
+
+        if (previous == InvalidIndex)
+        {
+            entry->head.store(index, std::memory_order_release);
+        }
+        else
+        {
+            _next[previous].store(index, std::memory_order_release);
+        }
+
+        if (first)
+        {
+            entry->summary = &summary;
+            summary.add(entry->key);
+        }
+
+        _senderLinks[index].attach(senderList, handler);
+
+        if (receiverList)
+        {
+            _receiverLinks[index].attach(*receiverList, handler);
+        }
+
+        return ConnectionHandle<>(index, _generation[index]);
+    }
+
+    /**
+     *  \fn         remove(Index index, std::uint16_t generation)
+     *  \brief      Removes the connection referenced by a handle in constant time.
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  generation passes the generation of the connection.
+     *  \return     Boolean indicating if the connection existed and the wiring isn't frozen.
+     */
+    EMBEDDED_SIGNALS_OUTLINE bool remove(Index index, std::uint16_t generation)
+    {
+        if (!Wiring::permits() || !contains(index, generation))
+        {
+            return false;
+        }
+
+        erase(index);
+
+        return true;
+    }
+
+    /**
+     *  \fn         join(Index index, std::uint16_t generation, ConnectionGroup& group)
+     *  \brief      Moves the connection referenced by a handle into a group.
+     *  \note       A connection belongs to a single group, joining another group leaves the
+     *              previous one.
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  generation passes the generation of the connection.
+     *  \param[in]  group passes the group to join.
+     *  \return     Boolean indicating if the connection exists, the group is valid and the
+     *              wiring isn't frozen.
+     */
+    EMBEDDED_SIGNALS_OUTLINE bool join(Index index, std::uint16_t generation, ConnectionGroup& group)
+    {
+        if (!Wiring::permits() || !group.isValid() || !contains(index, generation))
+        {
+            return false;
+        }
+
+        if constexpr (ConnectionGroup::Capacity > 0)
+        {
+            _groupLinks[index].detach();
+            _groupLinks[index].attach(group._members, _senderLinks[index].handler);
+            _groups[index].store(group._id, std::memory_order_relaxed);
+            _limits[index].fetch_or(Grouped, std::memory_order_release);
+        }
+
+        return true;
+    }
+
+    /**
+     *  \fn         block(Index index, std::uint16_t generation, bool blocked)
+     *  \brief      Blocks or unblocks the connection referenced by a handle in constant time.
+     *  \note       A connection blocked by its receiver as well stays blocked until both unblock it.
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  generation passes the generation of the connection.
+     *  \param[in]  blocked passes whether emits skip the connection.
+     *  \return     Boolean indicating if the connection existed.
+     */
+    EMBEDDED_SIGNALS_OUTLINE bool block(Index index, std::uint16_t generation, bool blocked)
+    {
+        if (!contains(index, generation))
+        {
+            return false;
+        }
+
+        updateBlock(index, HandleBlock, blocked);
+
+        return true;
+    }
+
+    /**
+     *  \fn         blocked(Index index, std::uint16_t generation) const
+     *  \brief      Checks if the connection referenced by a handle is blocked for any reason.
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  generation passes the generation of the connection.
+     *  \return     Boolean indicating result of check.
+     */
+    bool blocked(Index index, std::uint16_t generation) const
+    {
+        return contains(index, generation) && _blocks[index] != 0;
+    }
+
+    /**
+     *  \fn         contains(Index index, std::uint16_t generation) const
+     *  \brief      Checks if the connection referenced by a handle still exists.
+     *  \note       Expired connections are reported as removed.
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  generation passes the generation of the connection.
+     *  \return     Boolean indicating result of check.
+     */
+    bool contains(Index index, std::uint16_t generation) const
+    {
+        return index < _used &&
+               _generation[index] == generation &&
+               (_limits[index].load(std::memory_order_relaxed) & Limit) != Expired;
+    }
+
+    /**
+     *  \fn         receiver(Index index) const
+     *  \brief      Returns the receiver of a connection claimed by an emit.
+     *  \param[in]  index passes the index of the connection.
+     *  \return     Pointer to the receiver instance or nullptr if there is none.
+     */
+    const SignalObject* receiver(Index index) const
+    {
+        return _receivers[index];
+    }
+
+    /**
+     *  \fn         connected(const SignalId& key)
+     *  \brief      Checks if a signal has connections or waiting coroutines.
+     *  \note       The check is lock-free and may run concurrently to the modifying context.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \return     Boolean indicating result of check.
+     */
+    bool connected(const SignalId& key)
+    {
+        _emissions.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        const SignalEntry* entry = find(key);
+        const bool result = entry && (entry->head.load(std::memory_order_acquire) != InvalidIndex || entry->waiters);
+
+        _emissions.fetch_sub(1, std::memory_order_seq_cst);
+
+        return result;
+    }
+
+    /**
+     *  \fn         removeMatching()
+     *  \brief      Removes all connections of a signal to a receiver whose slot matches.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \param[in]  receiver passes a pointer to the receiver instance.
+     *  \param[in]  matches passes the function comparing the slot of a connection.
+     *  \param[in]  context passes the argument of the function.
+     */
+    EMBEDDED_SIGNALS_OUTLINE void removeMatching(const SignalId& key,
+                                                 const SignalObject* receiver,
+                                                 bool (*matches)(const void* context, Index index),
+                                                 const void* context
+    )
+    {
+        if (!Wiring::permits())
+        {
+            return;
+        }
+
+        SignalEntry* entry = find(key);
+
+        if (!entry)
+        {
+            return;
+        }
+
+        Index index = entry->head.load(std::memory_order_relaxed);
+
+        while (index != InvalidIndex)
+        {
+            const Index next = _next[index].load(std::memory_order_relaxed);
+
+            if (_receivers[index] == receiver && matches(context, index))
+            {
+                unlink(entry, index);
+            }
+
+            index = next;
+        }
+
+        if (unused(entry))
+        {
+            release(entry);
+        }
+
+        reclaim();
+    }
+
+    /**
+     *  \fn         wait(const SignalId& key, SignalWaiterBase* waiter)
+     *  \brief      Appends a suspended coroutine to the waiter list of a signal.
+     *  \note       While the wiring is frozen, only signals already inside the index are awaited.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \param[in]  waiter passes a pointer to the coroutine's waiter.
+     *  \return     Boolean indicating if the waiter was linked, false if the index is full.
+     */
+    EMBEDDED_SIGNALS_OUTLINE bool wait(const SignalId& key, SignalWaiterBase* waiter)
+    {
+        SignalEntry* entry = Wiring::frozen() ? find(key) : findOrCreate(key);
+
+        if (!entry)
+        {
+            return false;
+        }
+
+        waiter->entry = static_cast<Index>(entry - _signals);
+        waiter->next = nullptr;
+        _waiting.store(_waiting.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        if (!entry->waiters)
+        {
+            waiter->previous = waiter;
+            entry->waiters = waiter;
+        }
+        else
+        {
+            waiter->previous = entry->waiters->previous;
+            waiter->previous->next = waiter;
+            entry->waiters->previous = waiter;
+        }
+
+        return true;
+    }
+
+    /**
+     *  \fn         dispatch(const SignalId& key, Capture&& capture, Fire&& fire, std::uint32_t emits)
+     *  \brief      Runs an emit over the connection list of a signal.
+     *  \details    Waiting coroutines capture the arguments before the slots are called and are
+     *              resumed afterwards. Connections made during the emit and expired ones are
+     *              skipped.
+     *  \tparam     Capture passes the typename of the callable storing arguments in a waiter.
+     *  \tparam     Fire passes the typename of the callable calling a connection's slot.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \param[in]  capture passes the callable storing the arguments inside a waiter.
+     *  \param[in]  fire passes the callable calling a slot, which receives the connection's
+     *              index and whether it is the list's last one.
+     *  \param[in]  emits passes the number of emits to count for the instrumentation.
+     *  \param[in]  join passes the callable completing slots deferred by fire, which runs
+     *              before the connections may be reclaimed.
+     */
+    template<class Capture, class Fire, class Join = Unjoined>
+    void dispatch(const SignalId& key,
+                  Capture&& capture,
+                  Fire&& fire,
+                  [[maybe_unused]] std::uint32_t emits = 1,
+                  Join&& join = Join{}
+    )
+    {
+        SignalWaiterBase* waiters = nullptr;
+
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+        const std::uint32_t start = EMBEDDED_SIGNALS_CLOCK::now();
+#endif
+
+        _emissions.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        const std::uint16_t epoch = _epoch.load(std::memory_order_acquire);
+
+        if (SignalEntry* entry = find(key))
+        {
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+            SignalEntry* const root = entry;
+#endif
+            Index forwarders[ForwardDepth];
+            std::size_t depth = 0;
+
+            while (true)
+            {
+                Index index;
+
+                if (entry)
+                {
+                    index = enter(entry, waiters, capture, emits);
+                    entry = nullptr;
+                }
+                else if (depth != 0)
+                {
+                    index = _next[forwarders[--depth]].load(std::memory_order_acquire);
+                }
+                else
+                {
+                    break;
+                }
+
+                while (index != InvalidIndex)
+                {
+                    const Index next = _next[index].load(std::memory_order_acquire);
+                    std::uint32_t state;
+
+                    if (claim(index, epoch, state))
+                    {
+                        if (state & Forwarding)
+                        {
+                            if (next != InvalidIndex)
+                            {
+                                forwarders[depth++] = index;
+                            }
+
+                            entry = &_signals[_forwards[index]];
+
+                            break;
+                        }
+
+                        fire(index, next == InvalidIndex && depth == 0);
+                    }
+
+                    if (next == InvalidIndex)
+                    {
+                        break;
+                    }
+
+                    index = _next[index].load(std::memory_order_acquire);
+                }
+            }
+
+            join();
+
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+            recordEmit(root, start);
+#endif
+        }
+
+        _emissions.fetch_sub(1, std::memory_order_seq_cst);
+
+        resume(waiters);
+    }
+
+    /**
+     *  \fn         dispatch(const SignalId& key, const DispatchTarget& target, std::uint32_t emits)
+     *  \brief      Runs an emit through the out of line loop shared by all signatures.
+     *  \note       The code size optimized mode trades an indirect call per slot for a single
+     *              copy of the loop.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \param[in]  target passes the typed steps of the emit.
+     *  \param[in]  emits passes the number of emits to count for the instrumentation.
+     */
+    EMBEDDED_SIGNALS_OUTLINE void dispatch(const SignalId& key, const DispatchTarget& target, std::uint32_t emits = 1)
+    {
+        dispatch(key,
+                 [&target](SignalWaiterBase* waiter) { target.capture(target.context, waiter); },
+                 [&target](Index index, bool last) { target.fire(target.context, index, last); },
+                 emits);
+    }
+
+    /**
+     *  \fn         measure(SignatureFootprint& footprint, std::size_t payload, std::size_t reserved) const
+     *  \brief      Reports the memory used by the connections of the core.
+     *  \param[out] footprint returns the footprint.
+     *  \param[in]  payload passes the size of a connection's dispatch payload.
+     *  \param[in]  reserved passes the size of the whole pool.
+     */
+    void measure(SignatureFootprint& footprint, std::size_t payload, std::size_t reserved) const
+    {
+        std::size_t signals = 0;
+
+        for (const SignalEntry& entry : _signals)
+        {
+            signals += entry.state.load(std::memory_order_relaxed) == EntryState::Used;
+        }
+
+        footprint.recordSize = recordSize() + payload;
+        footprint.entrySize = sizeof(SignalEntry);
+        footprint.connections = _live;
+        footprint.peak = _peak;
+        footprint.capacity = Capacity;
+        footprint.signals = signals;
+        footprint.bytesInUse = _live * footprint.recordSize + signals * footprint.entrySize;
+        footprint.peakBytes = _peak * footprint.recordSize;
+        footprint.bytesReserved = reserved;
+    }
+
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+    /**
+     *  \fn         record(Index index, std::uint32_t start)
+     *  \brief      Adds a slot call to the statistics of a connection.
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  start passes the clock tick the call started at.
+     */
+    void record(Index index, std::uint32_t start)
+    {
+        _statistics[index].record(EMBEDDED_SIGNALS_CLOCK::now() - start);
+    }
+
+    /**
+     *  \fn         recordEmit(SignalEntry* entry, std::uint32_t start)
+     *  \brief      Keeps the duration of an emit if it is the signal's longest so far.
+     *  \param[in]  entry passes a pointer to the signal's index entry.
+     *  \param[in]  start passes the clock tick the emit started at.
+     */
+    static void recordEmit(SignalEntry* entry, std::uint32_t start)
+    {
+        const std::uint32_t duration = EMBEDDED_SIGNALS_CLOCK::now() - start;
+        std::uint32_t worst = entry->worst.load(std::memory_order_relaxed);
+
+        while (duration > worst && !entry->worst.compare_exchange_weak(worst, duration, std::memory_order_relaxed));
+    }
+#endif
+
+private:
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+    /**
+     *  \fn         collect(const void* core, std::span<ConnectionReport> reports, std::size_t& count)
+     *  \brief      Offers the reports of all stored connections of a core to the top list.
+     *  \param[in]  core passes a pointer to the core.
+     *  \param[in]  reports passes the top list.
+     *  \param[in]  count passes and returns the number of reports inside the top list.
+     */
+    static void collect(const void* core, std::span<ConnectionReport> reports, std::size_t& count)
+    {
+        const ConnectionCore* self = static_cast<const ConnectionCore*>(core);
+
+        for (Index index = 0; index < self->_used; index++)
+        {
+            if (self->_senderLinks[index].empty())
+            {
+                continue;
+            }
+
+            const SignalEntry& entry = self->_signals[self->_entries[index]];
+            ConnectionReport report;
+
+            report.sender = entry.key.sender;
+            report.receiver = self->_receivers[index];
+            report.emits = entry.emits.load(std::memory_order_relaxed);
+            self->_statistics[index].report(report);
+
+            Instrumentation::offer(reports, count, report);
+        }
+    }
+
+    /**
+     *  \fn         collectSignals(const void* core, std::span<SignalReport> reports, std::size_t& count)
+     *  \brief      Offers the reports of all connected signals of a core to the top list.
+     *  \param[in]  core passes a pointer to the core.
+     *  \param[in]  reports passes the top list.
+     *  \param[in]  count passes and returns the number of reports inside the top list.
+     */
+    static void collectSignals(const void* core, std::span<SignalReport> reports, std::size_t& count)
+    {
+        const ConnectionCore* self = static_cast<const ConnectionCore*>(core);
+
+        for (const SignalEntry& entry : self->_signals)
+        {
+            if (entry.state.load(std::memory_order_relaxed) != EntryState::Used)
+            {
+                continue;
+            }
+
+            const std::size_t position = static_cast<std::size_t>(&entry - self->_signals);
+            SignalReport report;
+
+            report.sender = entry.key.sender;
+            report.probes = static_cast<std::uint32_t>(((position - slotOf(entry.key)) & (TableSize - 1)) + 1);
+            report.connections = static_cast<std::uint32_t>(self->reach(&entry, 0));
+            report.emits = entry.emits.load(std::memory_order_relaxed);
+            report.worst = entry.worst.load(std::memory_order_relaxed);
+
+            Instrumentation::offer(reports, count, report);
+        }
+    }
+
+    /**
+     *  \fn         reach(const SignalEntry* entry, std::size_t depth) const
+     *  \brief      Counts the connections an emit of a signal walks, following forwards.
+     *  \param[in]  entry passes a pointer to the signal's index entry.
+     *  \param[in]  depth passes the number of forwards passed so far.
+     *  \return     Number of connections.
+     */
+    std::size_t reach(const SignalEntry* entry, std::size_t depth) const
+    {
+        std::size_t connections = 0;
+
+        for (Index index = entry->head.load(std::memory_order_relaxed);
+             index != InvalidIndex;
+             index = _next[index].load(std::memory_order_relaxed)
+        )
+        {
+            connections++;
+
+            if (_forwards[index] != InvalidIndex && depth < ForwardDepth)
+            {
+                connections += reach(&_signals[_forwards[index]], depth + 1);
+            }
+        }
+
+        return connections;
+    }
+#endif
+
+    /**
+     *  \fn     recordSize(void)
+     *  \brief  Computes the bytes the core stores per connection.
+     *  \return Sum of the element sizes of all per connection arrays.
+     */
+    static constexpr std::size_t recordSize(void)
+    {
+        std::size_t size = sizeof(_next) + sizeof(_limits) + sizeof(_deadlines) + sizeof(_expiredNext) +
+                           sizeof(_forwards) + sizeof(_blocks) + sizeof(_entries) + sizeof(_receivers) +
+                           sizeof(_priorities) + sizeof(_previous) + sizeof(_generation) +
+                           sizeof(_senderLinks) + sizeof(_receiverLinks) + sizeof(_chain);
+
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+        size += sizeof(_statistics);
+#endif
+
+        size /= Capacity;
+
+        if constexpr (ConnectionGroup::Capacity > 0)
+        {
+            size += sizeof(_groups[0]) + sizeof(_groupLinks[0]);
+        }
+
+        return size;
+    }
+
+    /**
+     *  \fn         claim(Index index, std::uint16_t epoch, std::uint32_t& state)
+     *  \brief      Takes a shot of a connection before its slot is called.
+     *  \note       Forwarding and grouped connections are never Unlimited and take the slower path.
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  epoch passes the connect epoch at the start of the emit.
+     *  \param[out] state returns the connection's state before the shot was taken.
+     *  \return     Boolean indicating if the slot may be called.
+     */
+    EMBEDDED_SIGNALS_INLINE bool claim(Index index, std::uint16_t epoch, std::uint32_t& state)
+    {
+        state = _limits[index].load(std::memory_order_relaxed);
+
+        return state == Unlimited || claimLimited(index, epoch, state);
+    }
+
+    /**
+     *  \fn         claimLimited(Index index, std::uint16_t epoch, std::uint32_t state)
+     *  \brief      Takes a shot of an expiring connection and expires it on its last one.
+     *  \note       The connection is expired by exactly one emit, which queues it for removal.
+     *              Blocked connections and those of a disabled group are skipped without
+     *              taking a shot, the state is reloaded to acquire the group published by join().
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  epoch passes the connect epoch at the start of the emit.
+     *  \param[in]  state passes the connection's current limit, epoch and flags.
+     *  \return     Boolean indicating if the slot may be called.
+     */
+    EMBEDDED_SIGNALS_OUTLINE bool claimLimited(Index index, std::uint16_t epoch, std::uint32_t state)
+    {
+        if ((state & Blocked) || ((state & ~Flags) >> Births) > epoch)
+        {
+            return false;
+        }
+
+        if (ConnectionGroup::Capacity > 0 && (state & Grouped))
+        {
+            state = _limits[index].load(std::memory_order_acquire);
+
+            if (ConnectionGroup::disabled(_groups[index].load(std::memory_order_relaxed)))
+            {
+                return false;
+            }
+        }
+
+        bool call;
+        std::uint32_t desired;
+
+        do
+        {
+            const std::uint32_t limit = state & Limit;
+
+            if (limit == Expired)
+            {
+                return false;
+            }
+
+            const std::uint32_t shots = limit & Shots;
+
+            if ((limit & Timed) &&
+                static_cast<std::int32_t>(EMBEDDED_SIGNALS_DEADLINE_CLOCK::now() - _deadlines[index]) >= 0)
+            {
+                call = false;
+                desired = Expired;
+            }
+            else if (shots == 0)
+            {
+                return true;
+            }
+            else
+            {
+                call = true;
+                desired = shots == 1 ? Expired : limit - 1;
+            }
+
+            desired |= state & ~Limit;
+        }
+        while (!_limits[index].compare_exchange_weak(state, desired, std::memory_order_relaxed));
+
+        if ((desired & Limit) == Expired)
+        {
+            Index head = _expired.load(std::memory_order_relaxed);
+
+            do
+            {
+                _expiredNext[index] = head;
+            }
+            while (!_expired.compare_exchange_weak(head, index, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        return call;
+    }
+
+    /**
+     *  \fn         idle(void) const
+     *  \brief      Checks if no emission is in flight.
+     *  \note       The fence orders the unlinks and releases before the check, see _emissions.
+     *  \return     Boolean indicating result of check.
+     */
+    bool idle(void) const
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        return _emissions.load(std::memory_order_seq_cst) == 0;
+    }
+
+    /**
+     *  \fn         stamp(void)
+     *  \brief      Advances the connect epoch if an emission is in flight.
+     *  \note       The epoch saturates instead of wrapping and is reset by reclaim().
+     *  \return     Epoch of a new connection, 0 if it is visible to all emits.
+     */
+    std::uint16_t stamp(void)
+    {
+        if (idle())
+        {
+            return 0;
+        }
+
+        const std::uint16_t epoch = _epoch.load(std::memory_order_relaxed);
+
+        if (epoch == Newest)
+        {
+            return epoch;
+        }
+
+        _epoch.store(epoch + 1, std::memory_order_release);
+
+        return epoch + 1;
+    }
+
+    /**
+     *  \fn         updateBlock(Index index, std::uint8_t reason, bool blocked)
+     *  \brief      Adds or removes a reason a connection is blocked and updates its flag.
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  reason passes the reason to add or remove.
+     *  \param[in]  blocked passes whether the reason is added.
+     */
+    void updateBlock(Index index, std::uint8_t reason, bool blocked)
+    {
+        _blocks[index] = blocked ? _blocks[index] | reason : _blocks[index] & ~reason;
+
+        if (_blocks[index])
+        {
+            _limits[index].fetch_or(Blocked, std::memory_order_relaxed);
+        }
+        else
+        {
+            _limits[index].fetch_and(~Blocked, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  \fn         erase(Index index)
+     *  \brief      Removes a stored connection in constant time.
+     *  \param[in]  index passes the index of the connection.
+     */
+    void erase(Index index)
+    {
+        SignalEntry* entry = &_signals[_entries[index]];
+
+        unlink(entry, index);
+
+        if (unused(entry))
+        {
+            release(entry);
+        }
+
+        reclaim();
+    }
+
+    /**
+     *  \fn         unused(const SignalEntry* entry)
+     *  \brief      Checks if a signal has neither connections, waiting coroutines nor forwarders.
+     *  \param[in]  entry passes a pointer to the signal's index entry.
+     *  \return     Boolean indicating result of check.
+     */
+    static bool unused(const SignalEntry* entry)
+    {
+        return entry->head.load(std::memory_order_relaxed) == InvalidIndex && !entry->waiters && !entry->forwarders;
+    }
+
+    /**
+     *  \fn         enter(SignalEntry* entry, SignalWaiterBase*& waiters, Capture& capture, std::uint32_t emits)
+     *  \brief      Starts the walk of a signal's list by an emit.
+     *  \details    The signal's waiting coroutines capture the arguments and are appended to the
+     *              coroutines the emit resumes when done.
+     *  \tparam     Capture passes the typename of the callable storing arguments in a waiter.
+     *  \param[in]  entry passes a pointer to the signal's index entry.
+     *  \param[in]  waiters passes and returns the coroutines to resume.
+     *  \param[in]  capture passes the callable storing the arguments inside a waiter.
+     *  \param[in]  emits passes the number of emits to count for the instrumentation.
+     *  \return     Index of the signal's first connection.
+     */
+    template<class Capture>
+    Index enter(SignalEntry* entry, SignalWaiterBase*& waiters, Capture& capture, [[maybe_unused]] std::uint32_t emits)
+    {
+        if (entry->waiters)
+        {
+            SignalWaiterBase* taken = takeWaiters(entry, waiters);
+
+            for (SignalWaiterBase* waiter = taken; waiter; waiter = waiter->next)
+            {
+                capture(waiter);
+            }
+        }
+
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+        entry->emits.fetch_add(emits, std::memory_order_relaxed);
+#endif
+
+        return entry->head.load(std::memory_order_acquire);
+    }
+
+    /**
+     *  \fn         takeWaiters(SignalEntry* entry, SignalWaiterBase*& waiters)
+     *  \brief      Detaches all waiting coroutines of a signal and appends them to a list.
+     *  \note       Coroutines awaiting the signal again while being resumed wait for the next emit.
+     *  \param[in]  entry passes a pointer to the signal's index entry.
+     *  \param[in]  waiters passes and returns the first waiter of the list to append to.
+     *  \return     Pointer to the first detached waiter.
+     */
+    EMBEDDED_SIGNALS_OUTLINE SignalWaiterBase* takeWaiters(SignalEntry* entry, SignalWaiterBase*& waiters)
+    {
+        SignalWaiterBase* taken = entry->waiters;
+
+        entry->waiters = nullptr;
+
+        for (SignalWaiterBase* waiter = taken; waiter; waiter = waiter->next)
+        {
+            waiter->entry = InvalidIndex;
+            _waiting.store(_waiting.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        }
+
+        if (!waiters)
+        {
+            waiters = taken;
+        }
+        else if (taken)
+        {
+            SignalWaiterBase* last = taken->previous;
+
+            waiters->previous->next = taken;
+            taken->previous = waiters->previous;
+            waiters->previous = last;
+        }
+
+        if (unused(entry))
+        {
+            release(entry);
+        }
+
+        return taken;
+    }
+
+    /**
+     *  \fn         resume(SignalWaiterBase* waiters)
+     *  \brief      Resumes detached coroutines in the order they started waiting.
+     *  \param[in]  waiters passes a pointer to the first detached waiter.
+     */
+    static void resume(SignalWaiterBase* waiters)
+    {
+        while (waiters)
+        {
+            SignalWaiterBase* next = waiters->next;
+
+            waiters->handle.resume();
+            waiters = next;
+        }
+    }
+
+    /**
+     *  \fn         slotOf(const SignalId& key)
+     *  \brief      Computes the preferred index entry of a key.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \return     Position of the preferred entry.
+     */
+    static std::size_t slotOf(const SignalId& key)
+    {
+        return std::hash<SignalId>{}(key) & (TableSize - 1);
+    }
+
+    /**
+     *  \fn         find(const SignalId& key)
+     *  \brief      Searches the index entry of a sender's signal.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \return     Pointer to the entry or nullptr if the signal is not connected.
+     */
+    SignalEntry* find(const SignalId& key)
+    {
+        std::size_t position = slotOf(key);
+
+        for (std::size_t probe = 0; probe < TableSize; probe++)
+        {
+            SignalEntry& entry = _signals[position];
+            const EntryState state = entry.state.load(std::memory_order_acquire);
+
+            if (state == EntryState::Empty)
+            {
+                return nullptr;
+            }
+
+            if (state == EntryState::Used && entry.key == key)
+            {
+                return &entry;
+            }
+
+            position = (position + 1) & (TableSize - 1);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     *  \fn         findOrCreate(const SignalId& key)
+     *  \brief      Searches the index entry of a sender's signal and creates it if missing.
+     *  \param[in]  key passes the identifier of the sender's signal.
+     *  \return     Pointer to the entry or nullptr if the index is full.
+     */
+    SignalEntry* findOrCreate(const SignalId& key)
+    {
+        if (SignalEntry* entry = find(key))
+        {
+            return entry;
+        }
+
+        const bool reusable = idle();
+        std::size_t position = slotOf(key);
+
+        for (std::size_t probe = 0; probe < TableSize; probe++)
+        {
+            SignalEntry& entry = _signals[position];
+            const EntryState state = entry.state.load(std::memory_order_relaxed);
+
+            if (state == EntryState::Empty || (state == EntryState::Removed && reusable))
+            {
+                entry.key = key;
+                entry.head.store(InvalidIndex, std::memory_order_relaxed);
+                entry.waiters = nullptr;
+                entry.summary = nullptr;
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+                entry.emits.store(0, std::memory_order_relaxed);
+                entry.worst.store(0, std::memory_order_relaxed);
+#endif
+                entry.tail = InvalidIndex;
+                entry.state.store(EntryState::Used, std::memory_order_release);
+
+                return &entry;
+            }
+
+            position = (position + 1) & (TableSize - 1);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     *  \fn         release(SignalEntry* entry)
+     *  \brief      Releases an index entry without connections.
+     *  \note       The key of a removed entry stays untouched until no emission is in flight,
+     *              because a concurrent emit might still compare it.
+     *  \param[in]  entry passes a pointer to the entry to release.
+     */
+    void release(SignalEntry* entry)
+    {
+        std::size_t position = static_cast<std::size_t>(entry - _signals);
+
+        entry->state.store(EntryState::Removed, std::memory_order_release);
+
+        if (!idle() ||
+            _signals[(position + 1) & (TableSize - 1)].state.load(std::memory_order_relaxed) != EntryState::Empty
+        )
+        {
+            return;
+        }
+
+        for (std::size_t probe = 0;
+             probe < TableSize && _signals[position].state.load(std::memory_order_relaxed) == EntryState::Removed;
+             probe++
+        )
+        {
+            _signals[position].state.store(EntryState::Empty, std::memory_order_release);
+            position = (position - 1) & (TableSize - 1);
+        }
+    }
+
+    /**
+     *  \fn         allocate(void)
+     *  \brief      Takes an unused connection from the pool.
+     *  \return     Index of the connection or InvalidIndex if the pool is full.
+     */
+    Index allocate(void)
+    {
+        if (_free != InvalidIndex)
+        {
+            const Index index = _free;
+            _free = _chain[index];
+            _forwards[index] = InvalidIndex;
+
+            return index;
+        }
+
+        if (_used < Capacity)
+        {
+            _forwards[_used] = InvalidIndex;
+
+            return _used++;
+        }
+
+        return InvalidIndex;
+    }
+
+    /**
+     *  \fn         unlink(SignalEntry* entry, Index index)
+     *  \brief      Removes a connection from its signal's list and retires it.
+     *  \note       The connection keeps its link and is marked expired, so an emit standing on
+     *              a connection removed by its own slot passes the connections removed after
+     *              it without calling them. Removing a whole group thereby stays linear while
+     *              an emission is in flight.
+     *  \param[in]  entry passes a pointer to the signal's index entry.
+     *  \param[in]  index passes the index of the connection.
+     */
+    void unlink(SignalEntry* entry, Index index)
+    {
+        const Index previous = _previous[index];
+        const Index next = _next[index].load(std::memory_order_relaxed);
+
+        if (previous == InvalidIndex)
+        {
+            entry->head.store(next, std::memory_order_release);
+        }
+        else
+        {
+            _next[previous].store(next, std::memory_order_release);
+        }
+
+        if (next == InvalidIndex)
+        {
+            entry->tail = previous;
+        }
+        else
+        {
+            _previous[next] = previous;
+        }
+
+        if (previous == InvalidIndex && next == InvalidIndex && entry->summary)
+        {
+            entry->summary->remove(entry->key);
+        }
+
+        _limits[index].store(Expired, std::memory_order_relaxed);
+        _senderLinks[index].detach();
+        _receiverLinks[index].detach();
+
+        if constexpr (ConnectionGroup::Capacity > 0)
+        {
+            _groupLinks[index].detach();
+        }
+
+        _live--;
+
+        if (_forwards[index] != InvalidIndex)
+        {
+            SignalEntry* forward = &_signals[_forwards[index]];
+
+            forward->forwarders--;
+
+            if (unused(forward))
+            {
+                release(forward);
+            }
+        }
+
+        retire(index);
+    }
+
+    /**
+     *  \fn         depthAbove(const SignalEntry* entry)
+     *  \brief      Computes the longest chain of forwarding connections ending at a signal.
+     *  \param[in]  entry passes a pointer to the signal's index entry.
+     *  \return     Number of forwarding connections of the chain or more than ForwardDepth.
+     */
+    std::size_t depthAbove(const SignalEntry* entry) const
+    {
+        const Index position = static_cast<Index>(entry - _signals);
+        std::size_t depth = 0;
+
+        for (Index index = 0; index < _used && depth <= ForwardDepth; index++)
+        {
+            if (_forwards[index] == position && !_senderLinks[index].empty())
+            {
+                depth = std::max(depth, 1 + depthAbove(&_signals[_entries[index]]));
+            }
+        }
+
+        return depth;
+    }
+
+    /**
+     *  \fn         forwardsTo(const SignalEntry* entry, const SignalEntry* forward) const
+     *  \brief      Checks if a signal already forwards to another one.
+     *  \param[in]  entry passes a pointer to the entry of the forwarding signal.
+     *  \param[in]  forward passes a pointer to the entry of the forwarded signal.
+     *  \return     Boolean indicating result of check.
+     */
+    bool forwardsTo(const SignalEntry* entry, const SignalEntry* forward) const
+    {
+        const Index position = static_cast<Index>(forward - _signals);
+
+        for (Index index = entry->head.load(std::memory_order_relaxed);
+             index != InvalidIndex;
+             index = _next[index].load(std::memory_order_relaxed)
+        )
+        {
+            if (_forwards[index] == position &&
+                (_limits[index].load(std::memory_order_relaxed) & Limit) != Expired)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     *  \fn         depthBelow(const SignalEntry* entry, const SignalEntry* source)
+     *  \brief      Computes the longest chain of forwarding connections starting at a signal.
+     *  \param[in]  entry passes a pointer to the signal's index entry.
+     *  \param[in]  source passes a pointer to the entry of the signal to forward from.
+     *  \return     Number of forwarding connections of the chain or more than ForwardDepth if
+     *              the chain is too long or reaches the source.
+     */
+    std::size_t depthBelow(const SignalEntry* entry, const SignalEntry* source) const
+    {
+        if (entry == source)
+        {
+            return ForwardDepth + 1;
+        }
+
+        std::size_t depth = 0;
+
+        for (Index index = entry->head.load(std::memory_order_relaxed);
+             index != InvalidIndex && depth <= ForwardDepth;
+             index = _next[index].load(std::memory_order_relaxed)
+        )
+        {
+            if (_forwards[index] != InvalidIndex)
+            {
+                depth = std::max(depth, 1 + depthBelow(&_signals[_forwards[index]], source));
+            }
+        }
+
+        return depth;
+    }
+
+    /**
+     *  \fn         retire(Index index)
+     *  \brief      Invalidates the handles of an unlinked connection and marks it for reuse
+     *              once no emission is in flight.
+     *  \note       The connection and its link stay intact, so a concurrent emit standing
+     *              on it is still able to continue with the rest of the list.
+     *  \param[in]  index passes the index of the connection.
+     */
+    void retire(Index index)
+    {
+        _generation[index]++;
+        _chain[index] = _retired;
+        _retired = index;
+    }
+
+    /**
+     *  \fn         reclaim(void)
+     *  \brief      Returns the retired connections to the pool and unlinks expired connections
+     *              if no emission is in flight.
+     *  \note       Expired connections are drained after the retired ones were reclaimed, so a
+     *              connection is never reused while an emit may still queue it for removal.
+     *              Once the connect epoch reached Settle, all connections are stamped visible
+     *              again, which keeps the epoch from saturating at amortized constant cost.
+     */
+    void reclaim(void)
+    {
+        if ((_retired == InvalidIndex &&
+             _expired.load(std::memory_order_relaxed) == InvalidIndex &&
+             _epoch.load(std::memory_order_relaxed) < Settle) ||
+            !idle()
+        )
+        {
+            return;
+        }
+
+        if (_epoch.load(std::memory_order_relaxed) >= Settle)
+        {
+            for (Index index = 0; index < _used; index++)
+            {
+                _limits[index].fetch_and(Limit | Flags, std::memory_order_relaxed);
+            }
+
+            _epoch.store(0, std::memory_order_release);
+        }
+
+        while (_retired != InvalidIndex)
+        {
+            const Index index = _retired;
+            _retired = _chain[index];
+
+            _receivers[index] = nullptr;
+            _chain[index] = _free;
+            _free = index;
+        }
+
+        Index index = _expired.exchange(InvalidIndex, std::memory_order_acquire);
+
+        while (index != InvalidIndex)
+        {
+            const Index next = _expiredNext[index];
+
+            if (!_senderLinks[index].empty())
+            {
+                SignalEntry* entry = &_signals[_entries[index]];
+
+                unlink(entry, index);
+
+                if (unused(entry))
+                {
+                    release(entry);
+                }
+            }
+
+            index = next;
+        }
+    }
+
+    /**
+     *  \var    _next
+     *  \brief  Links of the connection lists read by concurrent emits.
+     */
+    std::atomic<Index> _next[Capacity]{};
+
+    /**
+     *  \var    _limits
+     *  \brief  Remaining shots, deadline flag and connect epoch of each connection, read by emits.
+     */
+    std::atomic<std::uint32_t> _limits[Capacity]{};
+
+    /**
+     *  \var    _deadlines
+     *  \brief  Deadline clock tick at which each timed connection expires.
+     */
+    std::uint32_t _deadlines[Capacity]{};
+
+    /**
+     *  \var    _expiredNext
+     *  \brief  Links of the list of expired connections, written by emits.
+     */
+    Index _expiredNext[Capacity]{};
+
+    /**
+     *  \var    _forwards
+     *  \brief  Position of the forwarded signal inside the signal index or InvalidIndex for
+     *          connections calling a slot, read by emits.
+     */
+    Index _forwards[Capacity]{};
+
+    /**
+     *  \var    _groups
+     *  \brief  Group of each grouped connection, read by emits.
+     */
+    std::atomic<ConnectionGroup::Id> _groups[GroupSlots]{};
+
+    /**
+     *  \var    _blocks
+     *  \brief  Reasons each connection is blocked for, only used by the modifying context.
+     */
+    std::uint8_t _blocks[Capacity]{};
+
+    /**
+     *  \var    _entries
+     *  \brief  Position of each connection's signal inside the signal index.
+     */
+    Index _entries[Capacity]{};
+
+    /**
+     *  \var    _receivers
+     *  \brief  Receiver of each connection, only used to disconnect by slot.
+     */
+    const SignalObject* _receivers[Capacity]{};
+
+    /**
+     *  \var    _priorities
+     *  \brief  Priority of each connection, only used to order insertions.
+     */
+    ConnectionPriority _priorities[Capacity]{};
+
+    /**
+     *  \var    _previous
+     *  \brief  Backward links of the connection lists, only used by the modifying context.
+     */
+    Index _previous[Capacity]{};
+
+    /**
+     *  \var    _generation
+     *  \brief  Generation of each connection, bumped whenever it is removed.
+     */
+    std::uint16_t _generation[Capacity]{};
+
+    /**
+     *  \var    _senderLinks
+     *  \brief  Links of the connections into their sender's connection list.
+     */
+    ConnectionLink _senderLinks[Capacity]{};
+
+    /**
+     *  \var    _receiverLinks
+     *  \brief  Links of the connections into their receiver's connection list.
+     */
+    ConnectionLink _receiverLinks[Capacity]{};
+
+    /**
+     *  \var    _groupLinks
+     *  \brief  Links of the connections into their group's connection list.
+     */
+    ConnectionLink _groupLinks[GroupSlots]{};
+
+    /**
+     *  \var    _chain
+     *  \brief  Links of the free list and the retired list.
+     */
+    Index _chain[Capacity]{};
+
+    /**
+     *  \var    _signals
+     *  \brief  Open addressing index mapping sender signals to connection lists.
+     */
+    SignalEntry _signals[TableSize]{};
+
+    /**
+     *  \var    _free
+     *  \brief  Index of the first released connection.
+     */
+    Index _free = InvalidIndex;
+
+    /**
+     *  \var    _retired
+     *  \brief  Index of the first connection waiting for reclamation.
+     */
+    Index _retired = InvalidIndex;
+
+    /**
+     *  \var    _expired
+     *  \brief  Index of the first expired connection waiting for removal.
+     */
+    std::atomic<Index> _expired = InvalidIndex;
+
+    /**
+     *  \var    _epoch
+     *  \brief  Number of connections made while an emission was in flight since the last reset.
+     *  \details Only the modifying context writes the epoch. An emit reads it once after the
+     *          fence following its increment of _emissions, so stamp() sees the emit and a
+     *          connection made after that read is stamped above the read epoch, which the emit
+     *          skips. The release stores pair with the acquire load of dispatch(), so an emit
+     *          reading the reset of reclaim() also sees the cleared births.
+     */
+    std::atomic<std::uint16_t> _epoch = 0;
+
+    /**
+     *  \var    _used
+     *  \brief  Number of connections taken from the pool so far.
+     */
+    Index _used = 0;
+
+    /**
+     *  \var    _live
+     *  \brief  Number of stored connections.
+     */
+    Index _live = 0;
+
+    /**
+     *  \var    _peak
+     *  \brief  Highest number of connections stored at the same time.
+     */
+    Index _peak = 0;
+
+    /**
+     *  \var    _emissions
+     *  \brief  Number of emits currently iterating the pool.
+     *  \details An emit increments the counter before a seq_cst fence and reads the lists
+     *          afterwards, while the modifying context publishes unlinks and released entries
+     *          before the seq_cst fence of idle(). Both fences are totally ordered, so either
+     *          the emit sees the new links or idle() sees the emit and nothing is reused.
+     */
+    std::atomic<std::uint32_t> _emissions = 0;
+
+    /**
+     *  \var    _waiting
+     *  \brief  Number of coroutines waiting for a signal of the core.
+     */
+    std::atomic<std::uint32_t> _waiting = 0;
+
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+    /**
+     *  \var    _statistics
+     *  \brief  Slot latency statistics of each connection.
+     */
+    SlotStatistics _statistics[Capacity]{};
+
+    /**
+     *  \var    _source
+     *  \brief  Registration of the core at the instrumentation registry.
+     */
+    InstrumentationSource _source{this, &collect, &collectSignals};
+#endif
+};
+
+#endif //CONNECTION_CORE_HPP
\ No newline at end of file
@@ -0,0 +1,278 @@
+/**
+ *  \file   connectionGroup.hpp
+ *  \brief  The file implements a scope of connections enabled, disabled and removed together.
+ */
+
+#ifndef CONNECTION_GROUP_HPP
+#define CONNECTION_GROUP_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "connectionLink.hpp"
+#include "wiring.hpp"
+
+#ifndef EMBEDDED_SIGNALS_MAX_GROUPS
+/**
+ *  \def    EMBEDDED_SIGNALS_MAX_GROUPS
+ *  \brief  Maximum number of connection groups alive at the same time, at most 32.
+ *  \note   Defining 0 drops the group state and link of every connection record.
+ */
+#define EMBEDDED_SIGNALS_MAX_GROUPS 32
+#endif
+
+template<std::size_t Capacity, std::size_t TableSize>
+class ConnectionCore;
+
+/**
+ *  \class  ConnectionGroup
+ *  \brief  The class represents a scope of connections of any signature switched together.
+ *  \details Connections join a group by their handle, e.g. all connections of an operating
+ *          mode. Destroying or releasing the group removes all of them at constant cost per
+ *          connection. The enable flags of all groups share a single word, so a group is
+ *          switched for all emits at once and switching from one group to another never
+ *          exposes a state with both or neither enabled. Emits only check the flag of
+ *          connections inside a group.
+ *  \note   Groups must be created, switched and destroyed by the context connecting and
+ *          disconnecting. Emits in flight may still call connections of a group just disabled.
+ */
+class ConnectionGroup
+{
+public:
+    /**
+     *  \typedef    Id
+     *  \brief      Type identifying a group's flag.
+     */
+    using Id = std::uint8_t;
+
+    /**
+     *  \var    InvalidId
+     *  \brief  Identifier of a group that could not be created.
+     */
+    static constexpr Id InvalidId = UINT8_MAX;
+
+    /**
+     *  \var    Capacity
+     *  \brief  Maximum number of groups alive at the same time.
+     */
+    static constexpr std::size_t Capacity = EMBEDDED_SIGNALS_MAX_GROUPS;
+
+    static_assert(Capacity <= 32, "Invalid group capacity.");
+
+    /**
+     *  \fn         ConnectionGroup(bool enabled)
+     *  \brief      The constructor initializes an empty group.
+     *  \note       The group is invalid if Capacity groups are alive already, connections
+     *              can't join an invalid group.
+     *  \param[in]  enabled passes whether the connections joining the group are called, a
+     *              disabled group allows wiring the next mode in advance.
+     */
+    explicit ConnectionGroup(bool enabled = true) :
+            _id(acquire())
+    {
+        if (!enabled)
+        {
+            disable();
+        }
+    }
+
+    ConnectionGroup(const ConnectionGroup&) = delete;
+    ConnectionGroup& operator=(const ConnectionGroup&) = delete;
+
+    /**
+     *  \fn     ~ConnectionGroup(void)
+     *  \brief  Destroys the group and removes all of its connections.
+     */
+    ~ConnectionGroup(void)
+    {
+        clear();
+
+        if (isValid())
+        {
+            _disabled.fetch_and(~flagOf(_id), std::memory_order_relaxed);
+            _taken &= ~flagOf(_id);
+        }
+    }
+
+    /**
+     *  \fn     isValid(void) const
+     *  \brief  Checks if connections are able to join the group.
+     *  \return Boolean indicating result of check.
+     */
+    bool isValid(void) const
+    {
+        return _id != InvalidId;
+    }
+
+    /**
+     *  \fn     empty(void) const
+     *  \brief  Checks if the group contains any connection.
+     *  \return Boolean indicating result of check.
+     */
+    bool empty(void) const
+    {
+        return _members.empty();
+    }
+
+    /**
+     *  \fn     isEnabled(void) const
+     *  \brief  Checks if the connections of the group are called by emits.
+     *  \return Boolean indicating result of check.
+     */
+    bool isEnabled(void) const
+    {
+        return isValid() && !disabled(_id);
+    }
+
+    /**
+     *  \fn     enable(void)
+     *  \brief  Lets emits call the connections of the group again.
+     */
+    void enable(void)
+    {
+        switchTo(nullptr, this);
+    }
+
+    /**
+     *  \fn     disable(void)
+     *  \brief  Keeps emits from calling the connections of the group.
+     *  \note   Disabled connections still count as connected, e.g. for isConnected().
+     */
+    void disable(void)
+    {
+        switchTo(this, nullptr);
+    }
+
+    /**
+     *  \fn         switchTo(ConnectionGroup& group)
+     *  \brief      Disables the group and enables another one with a single store.
+     *  \param[in]  group passes the group to enable.
+     */
+    void switchTo(ConnectionGroup& group)
+    {
+        switchTo(this, &group);
+    }
+
+    /**
+     *  \fn     release(void)
+     *  \brief  Removes all connections of the group, which stays usable.
+     *  \note   The cost is linear in the group's own connections only. Nothing is removed
+     *          while the wiring is frozen.
+     */
+    void release(void)
+    {
+        if (Wiring::permits())
+        {
+            clear();
+        }
+    }
+
+private:
+    template<std::size_t, std::size_t>
+    friend class ConnectionCore;
+
+    /**
+     *  \fn     clear(void)
+     *  \brief  Removes all connections of the group, even if the wiring is frozen.
+     */
+    void clear(void)
+    {
+        while (!_members.empty())
+        {
+            ConnectionLink* link = static_cast<ConnectionLink*>(_members.next);
+            link->handler(link, LinkAction::Remove);
+        }
+    }
+
+    /**
+     *  \fn         flagOf(Id id)
+     *  \brief      Computes the mask of a group's flag.
+     *  \param[in]  id passes the group's identifier.
+     *  \return     Mask of the flag.
+     */
+    static std::uint32_t flagOf(Id id)
+    {
+        return std::uint32_t{1} << id;
+    }
+
+    /**
+     *  \fn         disabled(Id id)
+     *  \brief      Checks if a group is disabled, called by emits.
+     *  \param[in]  id passes the group's identifier.
+     *  \return     Boolean indicating result of check.
+     */
+    static bool disabled(Id id)
+    {
+        return (_disabled.load(std::memory_order_relaxed) & flagOf(id)) != 0;
+    }
+
+    /**
+     *  \fn         switchTo(const ConnectionGroup* disabling, const ConnectionGroup* enabling)
+     *  \brief      Updates the flags of two groups with a single store.
+     *  \param[in]  disabling passes the group to disable or nullptr.
+     *  \param[in]  enabling passes the group to enable or nullptr.
+     */
+    static void switchTo(const ConnectionGroup* disabling, const ConnectionGroup* enabling)
+    {
+        std::uint32_t flags = _disabled.load(std::memory_order_relaxed);
+
+        if (disabling && disabling->isValid())
+        {
+            flags |= flagOf(disabling->_id);
+        }
+
+        if (enabling && enabling->isValid())
+        {
+            flags &= ~flagOf(enabling->_id);
+        }
+
+        _disabled.store(flags, std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn     acquire(void)
+     *  \brief  Takes the lowest unused group identifier.
+     *  \return Identifier of the group or InvalidId if all are taken.
+     */
+    static Id acquire(void)
+    {
+        const unsigned id = static_cast<unsigned>(std::countr_one(_taken));
+
+        if (id >= Capacity)
+        {
+            return InvalidId;
+        }
+
+        _taken |= flagOf(static_cast<Id>(id));
+
+        return static_cast<Id>(id);
+    }
+
+    /**
+     *  \var    _disabled
+     *  \brief  Flags of all disabled groups, read by emits.
+     */
+    inline static std::atomic<std::uint32_t> _disabled = 0;
+
+    /**
+     *  \var    _taken
+     *  \brief  Flags of all groups alive.
+     */
+    inline static std::uint32_t _taken = 0;
+
+    /**
+     *  \var    _id
+     *  \brief  Identifier of the group's flag.
+     */
+    const Id _id;
+
+    /**
+     *  \var    _members
+     *  \brief  Sentinel of the list of the group's connections.
+     */
+    ConnectionList _members;
+};
+
+#endif //CONNECTION_GROUP_HPP
\ No newline at end of file
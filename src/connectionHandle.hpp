@@ -0,0 +1,106 @@
+/**
+ *  \file   connectionHandle.hpp
+ *  \brief  The file implements a lightweight reference to a stored connection.
+ */
+
+#ifndef CONNECTION_HANDLE_HPP
+#define CONNECTION_HANDLE_HPP
+
+#include <cstdint>
+
+/**
+ *  \typedef    ConnectionIndex
+ *  \brief      Type used to address a connection inside its pool.
+ */
+using ConnectionIndex = std::uint16_t;
+
+/**
+ *  \class  ConnectionHandle
+ *  \brief  The class references a connection by its pool index and generation.
+ *  \details The generation is bumped whenever a connection is removed, so handles to
+ *          removed connections are detected by a single comparison.
+ *  \tparam ParamPack passes the signal's and slot's parameter pack.
+ */
+template<class... ParamPack>
+class ConnectionHandle
+{
+public:
+    /**
+     *  \var    InvalidIndex
+     *  \brief  Index of a handle not referencing any connection.
+     */
+    static constexpr ConnectionIndex InvalidIndex = UINT16_MAX;
+
+    /**
+     *  \fn     ConnectionHandle(void)
+     *  \brief  The constructor initializes an invalid handle.
+     */
+    ConnectionHandle(void) = default;
+
+    /**
+     *  \fn         ConnectionHandle(ConnectionIndex index, std::uint16_t generation)
+     *  \brief      The constructor initializes a handle referencing a connection.
+     *  \param[in]  index passes the connection's index inside its pool.
+     *  \param[in]  generation passes the connection's generation.
+     */
+    ConnectionHandle(ConnectionIndex index, std::uint16_t generation) :
+            _index(index),
+            _generation(generation)
+    {}
+
+    /**
+     *  \fn         isValid(void) const
+     *  \brief      Checks if the handle was returned by a successful connect.
+     *  \note       Use SignalObject::isConnected() to check if the connection still exists.
+     *  \return     Boolean indicating result of check.
+     */
+    bool isValid(void) const
+    {
+        return _index != InvalidIndex;
+    }
+
+    /**
+     *  \fn         operator bool(void) const
+     *  \brief      Checks if the handle was returned by a successful connect.
+     *  \return     Boolean indicating result of check.
+     */
+    explicit operator bool(void) const
+    {
+        return isValid();
+    }
+
+    /**
+     *  \fn         index(void) const
+     *  \brief      Returns the connection's index inside its pool.
+     *  \return     Index of the connection.
+     */
+    ConnectionIndex index(void) const
+    {
+        return _index;
+    }
+
+    /**
+     *  \fn         generation(void) const
+     *  \brief      Returns the connection's generation.
+     *  \return     Generation of the connection.
+     */
+    std::uint16_t generation(void) const
+    {
+        return _generation;
+    }
+
+private:
+    /**
+     *  \var    _index
+     *  \brief  Index of the connection inside its pool.
+     */
+    ConnectionIndex _index = InvalidIndex;
+
+    /**
+     *  \var    _generation
+     *  \brief  Generation of the connection at the time it was connected.
+     */
+    std::uint16_t _generation = 0;
+};
+
+#endif //CONNECTION_HANDLE_HPP
\ No newline at end of file
@@ -0,0 +1,110 @@
+/**
+ *  \file   connectionLink.hpp
+ *  \brief  The file implements the intrusive lists linking objects to their connections.
+ */
+
+#ifndef CONNECTION_LINK_HPP
+#define CONNECTION_LINK_HPP
+
+#include <cstdint>
+
+/**
+ *  \enum   LinkAction
+ *  \brief  The enum describes what an object's list applies to the connection owning a link.
+ */
+enum class LinkAction : std::uint8_t
+{
+    Remove,
+    Block,
+    Unblock
+};
+
+/**
+ *  \struct ConnectionList
+ *  \brief  The struct represents a node of an object's circular connection list.
+ *  \note   An object owns one node as the sentinel of its list.
+ */
+struct ConnectionList
+{
+    /**
+     *  \fn     ConnectionList(void)
+     *  \brief  The constructor initializes an empty list.
+     */
+    constexpr ConnectionList(void) :
+            previous(this),
+            next(this)
+    {}
+
+    ConnectionList(const ConnectionList&) = delete;
+    ConnectionList& operator=(const ConnectionList&) = delete;
+
+    /**
+     *  \fn     empty(void) const
+     *  \brief  Checks if the list contains any connection.
+     *  \return Boolean indicating result of check.
+     */
+    bool empty(void) const
+    {
+        return next == this;
+    }
+
+    /**
+     *  \var    previous
+     *  \brief  Pointer to the previous node of the list.
+     */
+    ConnectionList* previous;
+
+    /**
+     *  \var    next
+     *  \brief  Pointer to the next node of the list.
+     */
+    ConnectionList* next;
+};
+
+/**
+ *  \struct ConnectionLink
+ *  \brief  The struct links a stored connection into the list of its sender or receiver.
+ */
+struct ConnectionLink : ConnectionList
+{
+    /**
+     *  \fn     ConnectionLink(void)
+     *  \brief  The constructor initializes a detached link.
+     */
+    constexpr ConnectionLink(void) = default;
+
+    /**
+     *  \fn         attach(ConnectionList& list, void (*function)(ConnectionLink* link, LinkAction action))
+     *  \brief      Appends the link to an object's connection list.
+     *  \param[in]  list passes the sentinel of the object's list.
+     *  \param[in]  function passes the function removing or blocking the connection owning the link.
+     */
+    void attach(ConnectionList& list, void (*function)(ConnectionLink* link, LinkAction action))
+    {
+        handler = function;
+        previous = list.previous;
+        next = &list;
+        list.previous->next = this;
+        list.previous = this;
+    }
+
+    /**
+     *  \fn     detach(void)
+     *  \brief  Removes the link from the object's connection list it is attached to.
+     */
+    void detach(void)
+    {
+        previous->next = next;
+        next->previous = previous;
+        previous = this;
+        next = this;
+    }
+
+    /**
+     *  \var    handler
+     *  \brief  Function removing or blocking the connection owning the link.
+     */
+    void (*handler)(ConnectionLink* link, LinkAction action) = nullptr;
+};
+
+#endif //CONNECTION_LINK_HPP
\ No newline at end of file
@@ -0,0 +1,589 @@
+/**
+ *  \file   connectionPool.hpp
+ *  \brief  The file implements a statically sized storage of connections.
+ */
+
+#ifndef CONNECTION_POOL_HPP
+#define CONNECTION_POOL_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "argument.hpp"
+#include "batch.hpp"
+#include "clock.hpp"
+#include "connection.hpp"
+#include "connectionCore.hpp"
+#include "connectionGroup.hpp"
+#include "connectionHandle.hpp"
+#include "delegate.hpp"
+#include "footprint.hpp"
+#include "signalAwaiter.hpp"
+#include "signalKey.hpp"
+
+#ifndef EMBEDDED_SIGNALS_MAX_CONNECTIONS
+/**
+ *  \def    EMBEDDED_SIGNALS_MAX_CONNECTIONS
+ *  \brief  Default number of connections available per signature.
+ */
+#define EMBEDDED_SIGNALS_MAX_CONNECTIONS 16
+#endif
+
+#ifndef EMBEDDED_SIGNALS_MAX_SIGNALS
+/**
+ *  \def    EMBEDDED_SIGNALS_MAX_SIGNALS
+ *  \brief  Default number of connected sender signals available per signature.
+ */
+#define EMBEDDED_SIGNALS_MAX_SIGNALS 16
+#endif
+
+/**
+ *  \struct ConnectionCapacity
+ *  \brief  The struct configures the storage size of a signature.
+ *  \note   Specialize the struct to tune the capacity of a single signature.
+ *  \tparam ParamPack passes the signal's and slot's parameter pack.
+ */
+template<class... ParamPack>
+struct ConnectionCapacity
+{
+    /**
+     *  \var    connections
+     *  \brief  Maximum number of connections of the signature.
+     */
+    static constexpr std::size_t connections = EMBEDDED_SIGNALS_MAX_CONNECTIONS;
+
+    /**
+     *  \var    signals
+     *  \brief  Maximum number of distinct connected sender signals of the signature.
+     */
+    static constexpr std::size_t signals = EMBEDDED_SIGNALS_MAX_SIGNALS;
+};
+
+/**
+ *  \class  ConnectionPool
+ *  \brief  The class stores the connections of a signature without heap allocation.
+ *  \details The pool adds the typed dispatch payloads to the signature independent core,
+ *          so all signatures of equal capacity share the code for storage, matching and
+ *          expiry. The payloads are kept in a contiguous array read by emits, while the
+ *          core keeps the signal index, the list links and the data only needed to modify
+ *          the pool apart.
+ *          With EMBEDDED_SIGNALS_COMPACT defined, emits run through the core's out of line
+ *          dispatch loop and only a call and a capture thunk are instantiated per signature.
+ *  \tparam ParamPack passes the signal's and slot's parameter pack.
+ */
+template<class... ParamPack>
+class ConnectionPool : public ConnectionCore<ConnectionCapacity<ParamPack...>::connections,
+                                             std::bit_ceil(ConnectionCapacity<ParamPack...>::signals)>
+{
+public:
+    /**
+     *  \typedef    Core
+     *  \brief      Type of the signature independent core.
+     */
+    using Core = ConnectionCore<ConnectionCapacity<ParamPack...>::connections,
+                                std::bit_ceil(ConnectionCapacity<ParamPack...>::signals)>;
+
+    /**
+     *  \typedef    Index
+     *  \brief      Type used to address a connection inside the pool.
+     */
+    using Index = typename Core::Index;
+
+    /**
+     *  \typedef    Handle
+     *  \brief      Type referencing a connection of the pool.
+     */
+    using Handle = ConnectionHandle<ParamPack...>;
+
+    /**
+     *  \var    Capacity
+     *  \brief  Number of connections the pool is able to store.
+     */
+    static constexpr std::size_t Capacity = ConnectionCapacity<ParamPack...>::connections;
+
+    /**
+     *  \var    TableSize
+     *  \brief  Number of entries of the signal index.
+     */
+    static constexpr std::size_t TableSize = std::bit_ceil(ConnectionCapacity<ParamPack...>::signals);
+
+    using Core::cancel;
+    using Core::control;
+
+    /**
+     *  \fn         insert()
+     *  \brief      Stores a connection behind all connections of its signal with equal or higher priority.
+     *  \note       The list is kept ordered on insertion, so emits never sort. Appending a
+     *              connection of the lowest priority so far takes constant time.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \param[in]  receiver passes a pointer to the receiver instance or nullptr if there is none.
+     *  \param[in]  connection passes the dispatch payload of the connection.
+     *  \param[in]  priority passes the connection's priority, higher priorities are called first.
+     *  \param[in]  expiry passes when the connection removes itself.
+     *  \param[in]  senderList passes the connection list of the sender instance.
+     *  \param[in]  summary passes the connection summary of the sender instance.
+     *  \param[in]  receiverList passes the connection list of the receiver instance or nullptr.
+     *  \param[in]  blocked passes whether the receiver's slots are blocked.
+     *  \param[in]  handler passes the function removing or blocking a connection by one of its links.
+     *  \return     Handle of the stored connection or an invalid handle if the pool is full.
+     */
+    Handle insert(const SignalKey<ParamPack...>& key,
+                  const SignalObject* receiver,
+                  const Connection<ParamPack...>& connection,
+                  ConnectionPriority priority,
+                  ConnectionExpiry expiry,
+                  ConnectionList& senderList,
+                  SignalSummary& summary,
+                  ConnectionList* receiverList,
+                  bool blocked,
+                  void (*handler)(ConnectionLink* link, LinkAction action)
+    )
+    {
+        Index index;
+        typename Core::SignalEntry* entry = this->prepare(SignalId(key), expiry, index);
+
+        if (!entry)
+        {
+            return Handle();
+        }
+
+        _connections[index] = connection;
+
+        const ConnectionHandle<> handle = this->link(entry, index, receiver, priority, expiry,
+                                                     senderList, summary, receiverList, blocked, handler);
+
+        Footprint::attach(_footprintSource);
+
+        return Handle(handle.index(), handle.generation());
+    }
+
+    /**
+     *  \fn         insertForward()
+     *  \brief      Stores a connection forwarding a signal to the slots of another signal.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \param[in]  target passes the key of the forwarded signal.
+     *  \param[in]  priority passes the connection's priority, higher priorities are called first.
+     *  \param[in]  expiry passes when the connection removes itself.
+     *  \param[in]  senderList passes the connection list of the sender instance.
+     *  \param[in]  summary passes the connection summary of the sender instance.
+     *  \param[in]  targetList passes the connection list of the forwarded signal's instance.
+     *  \param[in]  blocked passes whether the target blocks its slots.
+     *  \param[in]  handler passes the function removing or blocking a connection by one of its links.
+     *  \return     Handle of the stored connection or an invalid handle if the pool is full or
+     *              the chain is too long.
+     */
+    Handle insertForward(const SignalKey<ParamPack...>& key,
+                         const SignalKey<ParamPack...>& target,
+                         ConnectionPriority priority,
+                         ConnectionExpiry expiry,
+                         ConnectionList& senderList,
+                         SignalSummary& summary,
+                         ConnectionList& targetList,
+                         bool blocked,
+                         void (*handler)(ConnectionLink* link, LinkAction action)
+    )
+    {
+        Index index;
+        typename Core::SignalEntry* entry = this->prepareForward(SignalId(key), SignalId(target), expiry, index);
+
+        if (!entry)
+        {
+            return Handle();
+        }
+
+        _connections[index] = Connection<ParamPack...>();
+
+        const ConnectionHandle<> handle = this->link(entry, index, target.sender, priority, expiry,
+                                                     senderList, summary, &targetList, blocked, handler);
+
+        Footprint::attach(_footprintSource);
+
+        return Handle(handle.index(), handle.generation());
+    }
+
+    /**
+     *  \fn         remove(const Handle& handle)
+     *  \brief      Removes the connection referenced by a handle in constant time.
+     *  \param[in]  handle passes the handle of the connection.
+     *  \return     Boolean indicating if the connection existed.
+     */
+    bool remove(const Handle& handle)
+    {
+        return Core::remove(handle.index(), handle.generation());
+    }
+
+    /**
+     *  \fn         block(const Handle& handle, bool blocked)
+     *  \brief      Blocks or unblocks the connection referenced by a handle in constant time.
+     *  \param[in]  handle passes the handle of the connection.
+     *  \param[in]  blocked passes whether emits skip the connection.
+     *  \return     Boolean indicating if the connection existed.
+     */
+    bool block(const Handle& handle, bool blocked)
+    {
+        return Core::block(handle.index(), handle.generation(), blocked);
+    }
+
+    /**
+     *  \fn         blocked(const Handle& handle) const
+     *  \brief      Checks if the connection referenced by a handle is blocked.
+     *  \param[in]  handle passes the handle of the connection.
+     *  \return     Boolean indicating result of check.
+     */
+    bool blocked(const Handle& handle) const
+    {
+        return Core::blocked(handle.index(), handle.generation());
+    }
+
+    /**
+     *  \fn         join(const Handle& handle, ConnectionGroup& group)
+     *  \brief      Moves the connection referenced by a handle into a group.
+     *  \param[in]  handle passes the handle of the connection.
+     *  \param[in]  group passes the group to join.
+     *  \return     Boolean indicating if the connection exists and the group is valid.
+     */
+    bool join(const Handle& handle, ConnectionGroup& group)
+    {
+        return Core::join(handle.index(), handle.generation(), group);
+    }
+
+    /**
+     *  \fn         contains(const Handle& handle) const
+     *  \brief      Checks if the connection referenced by a handle still exists.
+     *  \note       Expired connections are reported as removed.
+     *  \param[in]  handle passes the handle of the connection.
+     *  \return     Boolean indicating result of check.
+     */
+    bool contains(const Handle& handle) const
+    {
+        return Core::contains(handle.index(), handle.generation());
+    }
+
+    /**
+     *  \fn     footprint(void) const
+     *  \brief  Reports the memory used by the connections of the signature.
+     *  \return Footprint of the pool.
+     */
+    SignatureFootprint footprint(void) const
+    {
+        SignatureFootprint footprint;
+
+        report(this, footprint);
+
+        return footprint;
+    }
+
+    /**
+     *  \fn         connected(const SignalKey<ParamPack...>& key)
+     *  \brief      Checks if a signal has connections or waiting coroutines.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \return     Boolean indicating result of check.
+     */
+    bool connected(const SignalKey<ParamPack...>& key)
+    {
+        return Core::connected(SignalId(key));
+    }
+
+    /**
+     *  \fn         remove(const SignalKey<ParamPack...>& key, const SignalObject* receiver, const Delegate<ParamPack...>& slot)
+     *  \brief      Removes all connections of a signal to the specified slot.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \param[in]  receiver passes a pointer to the receiver instance.
+     *  \param[in]  slot passes the callable of the receiver's slot.
+     */
+    void remove(const SignalKey<ParamPack...>& key,
+                const SignalObject* receiver,
+                const Delegate<ParamPack...>& slot
+    )
+    {
+        Match match{this, &slot};
+
+        this->removeMatching(SignalId(key), receiver, &matches, &match);
+    }
+
+    /**
+     *  \fn         fireAllSlots(const SignalKey<ParamPack...>& key, Args&&... args)
+     *  \brief      Calls all slots connected to the specified signal.
+     *  \details    Every slot except the last one receives a copy of each value argument,
+     *              the last one receives the emitted values themselves if they are rvalues.
+     *              Reference arguments are never copied. Awaiting coroutines receive copies
+     *              taken before the slots are called and are resumed afterwards.
+     *  \tparam     Args passes the types of the emitted arguments.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \param[in]  args passes the signal's parameter pack.
+     */
+    template<class... Args>
+    void fireAllSlots(const SignalKey<ParamPack...>& key, Args&&... args)
+    {
+#ifdef EMBEDDED_SIGNALS_COMPACT
+        Emit<Args...> emit{this, {args...}};
+
+        this->dispatch(SignalId(key), typename Core::DispatchTarget{&emit, &captureEmit<Args...>, &fireEmit<Args...>});
+#else
+        this->dispatch(SignalId(key),
+                       [&](SignalWaiterBase* waiter) { static_cast<Waiter*>(waiter)->values.emplace(args...); },
+                       [&](Index index, bool last)
+                       {
+                           if (last)
+                           {
+                               fireSlot(index, passArgument<ParamPack, !std::is_lvalue_reference_v<Args>>(args)...);
+                           }
+                           else
+                           {
+                               fireSlot(index, passArgument<ParamPack, false>(args)...);
+                           }
+                       });
+#endif
+    }
+
+    /**
+     *  \fn         fireParallel(const SignalKey<ParamPack...>& key, FanOut& fanOut, Args&&... args)
+     *  \brief      Calls all slots connected to the specified signal, in parallel where allowed.
+     *  \details    Slots of receivers allowing parallel slots are collected while the list is
+     *              walked and split across the fan-out's threads once the walk is done, all
+     *              others are called in order by the emitting thread first. The function
+     *              returns after every slot has finished. Every slot receives a copy of each value
+     *              argument. Lists reached more than once through forwarding connections
+     *              are split into several batches once the collected slots fill the pool's
+     *              capacity.
+     *  \tparam     FanOut passes the typename of the fan-out pool.
+     *  \tparam     Args passes the types of the emitted arguments.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \param[in]  fanOut passes the pool executing the parallel slots.
+     *  \param[in]  args passes the signal's parameter pack.
+     */
+    template<class FanOut, class... Args>
+    void fireParallel(const SignalKey<ParamPack...>& key, FanOut& fanOut, Args&&... args)
+    {
+        Index parallel[Capacity];
+        std::size_t count = 0;
+
+        auto flush = [&]
+        {
+            fanOut.run(count,
+                       [&](std::size_t begin, std::size_t end)
+                       {
+                           for (std::size_t slot = begin; slot < end; slot++)
+                           {
+                               fireSlot(parallel[slot], passArgument<ParamPack, false>(args)...);
+                           }
+                       });
+            count = 0;
+        };
+
+        this->dispatch(SignalId(key),
+                       [&](SignalWaiterBase* waiter) { static_cast<Waiter*>(waiter)->values.emplace(args...); },
+                       [&](Index index, bool)
+                       {
+                           const auto* receiver = this->receiver(index);
+
+                           if (receiver && receiver->parallelSlotsAllowed())
+                           {
+                               if (count == Capacity)
+                               {
+                                   flush();
+                               }
+
+                               parallel[count++] = index;
+                           }
+                           else
+                           {
+                               fireSlot(index, passArgument<ParamPack, false>(args)...);
+                           }
+                       },
+                       1,
+                       flush);
+    }
+
+    /**
+     *  \fn         fireBatch(const SignalKey<ParamPack...>& key, Batch<ParamPack...> batch)
+     *  \brief      Calls all slots connected to the specified signal for a batch of argument sets.
+     *  \details    The connection list is resolved once per batch, then each slot iterates
+     *              over the whole batch before the next slot is called. Awaiting coroutines
+     *              are resumed once with the batch's last argument set.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \param[in]  batch passes the argument sets.
+     */
+    void fireBatch(const SignalKey<ParamPack...>& key, Batch<ParamPack...> batch)
+    requires isBatchable<ParamPack...>
+    {
+        if (batch.empty())
+        {
+            this->dispatch(SignalId(key), [](SignalWaiterBase*) {}, [](Index, bool) {}, 0);
+
+            return;
+        }
+
+        this->dispatch(SignalId(key),
+                       [&batch](SignalWaiterBase* waiter)
+                       {
+                           static_cast<Waiter*>(waiter)->values.emplace(typename Waiter::Values(batch.back()));
+                       },
+                       [this, &batch](Index index, bool)
+                       {
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+                           const std::uint32_t start = EMBEDDED_SIGNALS_CLOCK::now();
+                           _connections[index].fireBatch(batch);
+                           this->record(index, start);
+#else
+                           _connections[index].fireBatch(batch);
+#endif
+                       },
+                       static_cast<std::uint32_t>(batch.size()));
+    }
+
+    /**
+     *  \fn         wait(const SignalKey<ParamPack...>& key, SignalWaiter<ParamPack...>* waiter)
+     *  \brief      Appends a suspended coroutine to the waiter list of a signal.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \param[in]  waiter passes a pointer to the coroutine's waiter.
+     *  \return     Boolean indicating if the waiter was linked, false if the index is full.
+     */
+    bool wait(const SignalKey<ParamPack...>& key, SignalWaiter<ParamPack...>* waiter)
+    {
+        return Core::wait(SignalId(key), waiter);
+    }
+
+private:
+    /**
+     *  \typedef    Waiter
+     *  \brief      Type of a coroutine waiting for a signal.
+     */
+    using Waiter = SignalWaiter<ParamPack...>;
+
+    /**
+     *  \struct Match
+     *  \brief  The struct passes the slot to disconnect to the core.
+     */
+    struct Match
+    {
+        /**
+         *  \var    pool
+         *  \brief  Pointer to the pool.
+         */
+        const ConnectionPool* pool;
+
+        /**
+         *  \var    slot
+         *  \brief  Pointer to the callable of the receiver's slot.
+         */
+        const Delegate<ParamPack...>* slot;
+    };
+
+    /**
+     *  \fn         report(const void* pool, SignatureFootprint& footprint)
+     *  \brief      Reports the memory used by the connections of a pool.
+     *  \param[in]  pool passes a pointer to the pool.
+     *  \param[out] footprint returns the footprint.
+     */
+    static void report(const void* pool, SignatureFootprint& footprint)
+    {
+        const ConnectionPool* self = static_cast<const ConnectionPool*>(pool);
+
+        self->measure(footprint, sizeof(Connection<ParamPack...>), sizeof(ConnectionPool));
+        footprint.pool = pool;
+    }
+
+    /**
+     *  \fn         matches(const void* context, Index index)
+     *  \brief      Checks if a connection calls the slot to disconnect.
+     *  \param[in]  context passes a pointer to the match.
+     *  \param[in]  index passes the index of the connection.
+     *  \return     Boolean indicating result of check.
+     */
+    static bool matches(const void* context, Index index)
+    {
+        const Match* match = static_cast<const Match*>(context);
+
+        return match->pool->_connections[index].isSlot(*match->slot);
+    }
+
+#ifdef EMBEDDED_SIGNALS_COMPACT
+    /**
+     *  \struct Emit
+     *  \brief  The struct passes the arguments of an emit to the out of line dispatch loop.
+     *  \note   Every slot receives a copy of each value argument in the code size optimized mode.
+     *  \tparam Args passes the types of the emitted arguments.
+     */
+    template<class... Args>
+    struct Emit
+    {
+        /**
+         *  \var    pool
+         *  \brief  Pointer to the pool.
+         */
+        ConnectionPool* pool;
+
+        /**
+         *  \var    args
+         *  \brief  References to the emitted arguments.
+         */
+        std::tuple<Args&...> args;
+    };
+
+    /**
+     *  \fn         captureEmit(void* context, SignalWaiterBase* waiter)
+     *  \brief      Stores copies of the emitted arguments inside a waiter.
+     *  \tparam     Args passes the types of the emitted arguments.
+     *  \param[in]  context passes a pointer to the emit.
+     *  \param[in]  waiter passes a pointer to the waiter.
+     */
+    template<class... Args>
+    static void captureEmit(void* context, SignalWaiterBase* waiter)
+    {
+        std::apply([waiter](auto&... values) { static_cast<Waiter*>(waiter)->values.emplace(values...); },
+                   static_cast<Emit<Args...>*>(context)->args);
+    }
+
+    /**
+     *  \fn         fireEmit(void* context, Index index, bool last)
+     *  \brief      Calls the slot of a connection with copies of the emitted arguments.
+     *  \tparam     Args passes the types of the emitted arguments.
+     *  \param[in]  context passes a pointer to the emit.
+     *  \param[in]  index passes the index of the connection.
+     */
+    template<class... Args>
+    static void fireEmit(void* context, Index index, bool)
+    {
+        Emit<Args...>* emit = static_cast<Emit<Args...>*>(context);
+
+        std::apply([emit, index](auto&... values) { emit->pool->fireSlot(index, passArgument<ParamPack, false>(values)...); },
+                   emit->args);
+    }
+#endif
+
+    /**
+     *  \fn         fireSlot(Index index, Argument<ParamPack>... args)
+     *  \brief      Calls the slot of a connection and records its latency if instrumented.
+     *  \param[in]  index passes the index of the connection.
+     *  \param[in]  args passes the slot's argument list.
+     */
+    void fireSlot(Index index, Argument<ParamPack>... args)
+    {
+#ifdef EMBEDDED_SIGNALS_INSTRUMENTATION
+        const std::uint32_t start = EMBEDDED_SIGNALS_CLOCK::now();
+        _connections[index].fireSlot(std::forward<ParamPack>(args)...);
+        this->record(index, start);
+#else
+        _connections[index].fireSlot(std::forward<ParamPack>(args)...);
+#endif
+    }
+
+    /**
+     *  \var    _connections
+     *  \brief  Dispatch payloads of the connections read by emits.
+     */
+    Connection<ParamPack...> _connections[Capacity]{};
+
+    /**
+     *  \var    _footprintSource
+     *  \brief  Registration of the pool at the footprint registry.
+     */
+    FootprintSource _footprintSource{this, &report};
+};
+
+#endif //CONNECTION_POOL_HPP
\ No newline at end of file
@@ -0,0 +1,386 @@
+/**
+ *  \file   delegate.hpp
+ *  \brief  The file implements a non-allocating type-erased callable.
+ */
+
+#ifndef DELEGATE_HPP
+#define DELEGATE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "argument.hpp"
+#include "batch.hpp"
+
+#ifndef EMBEDDED_SIGNALS_DELEGATE_SIZE
+/**
+ *  \def    EMBEDDED_SIGNALS_DELEGATE_SIZE
+ *  \brief  Number of bytes a delegate provides to store a callable inline.
+ *  \note   Connections to methods bound at compile time and lambdas capturing a single pointer
+ *          fit into sizeof(void*), which shrinks every connection record.
+ */
+#define EMBEDDED_SIGNALS_DELEGATE_SIZE (4 * sizeof(void*))
+#endif
+
+/**
+ *  \concept    isCallable
+ *  \brief      Checks if a callable can be stored in a delegate of the parameter pack.
+ *  \note       Callables taking a Batch of the parameter pack are stored as batch slots.
+ *  \tparam     Function passes the callable's typename.
+ *  \tparam     ParamPack passes the delegate's parameter pack.
+ */
+template<class Function, class... ParamPack>
+concept isCallable = (std::is_invocable_v<std::decay_t<Function>&, ParamPack...> ||
+                      std::is_invocable_v<std::decay_t<Function>&, Batch<ParamPack...>>) &&
+                     !std::is_member_function_pointer_v<std::decay_t<Function>>;
+
+/**
+ *  \concept    isComparable
+ *  \brief      Checks if delegates storing a callable can be compared byte by byte.
+ *  \note       Padding bytes inside a callable are indeterminate, so only empty callables and
+ *              callables without padding, e.g. functions, bound methods and lambdas capturing
+ *              pointers, compare reliably.
+ *  \tparam     Function passes the callable's typename.
+ */
+template<class Function>
+concept isComparable = std::is_empty_v<std::decay_t<Function>> ||
+                       std::has_unique_object_representations_v<std::decay_t<Function>>;
+
+/**
+ *  \class  Delegate
+ *  \brief  The class stores a callable inline and calls it through a single function pointer.
+ *  \note   Stored callables must be trivially copyable and destructible, which holds for free
+ *          functions, bound methods and lambdas capturing pointers or plain values.
+ *          A batch slot receives a whole Batch per call, single emits pass it a batch of one.
+ *  \tparam ParamPack passes the callable's parameter pack.
+ */
+template<class... ParamPack>
+class Delegate
+{
+public:
+    /**
+     *  \var    Size
+     *  \brief  Number of bytes available to store a callable inline.
+     */
+    static constexpr std::size_t Size = EMBEDDED_SIGNALS_DELEGATE_SIZE;
+
+    /**
+     *  \var    Alignment
+     *  \brief  Alignment of the inline storage, reduced for small sizes to avoid padding.
+     */
+    static constexpr std::size_t Alignment = std::min(alignof(std::max_align_t), std::bit_floor(Size));
+
+    static_assert(Size > 0, "Invalid delegate size.");
+
+    /**
+     *  \fn     Delegate(void)
+     *  \brief  The constructor initializes an empty delegate.
+     */
+    Delegate(void) = default;
+
+    /**
+     *  \fn         Delegate(Function&& function)
+     *  \brief      The constructor stores a copy of a callable.
+     *  \tparam     Function passes the callable's typename.
+     *  \param[in]  function passes the callable to store.
+     */
+    template<class Function>
+    requires isCallable<Function, ParamPack...> && (!std::is_same_v<std::decay_t<Function>, Delegate>)
+    Delegate(Function&& function)
+    {
+        using Callable = std::decay_t<Function>;
+
+        static_assert(sizeof(Callable) <= Size, "The callable exceeds EMBEDDED_SIGNALS_DELEGATE_SIZE.");
+        static_assert(alignof(Callable) <= Alignment, "Over-aligned callables are not supported.");
+        static_assert(std::is_trivially_copyable_v<Callable> && std::is_trivially_destructible_v<Callable>,
+                      "Delegates only store trivially copyable callables.");
+
+        new (_storage) Callable(std::forward<Function>(function));
+
+        if constexpr (std::is_empty_v<Callable>)
+        {
+            std::memset(_storage, 0, Size);
+        }
+
+        if constexpr (std::is_invocable_v<Callable&, ParamPack...>)
+        {
+            _invoke = &invokeCallable<Callable>;
+
+            if constexpr (isBatchable<ParamPack...>)
+            {
+                _invokeBatch = &invokeEach<Callable>;
+            }
+        }
+        else
+        {
+            _invoke = &invokeSingle<Callable>;
+            _invokeBatch = &invokeBatch<Callable>;
+        }
+    }
+
+    /**
+     *  \fn         Delegate(Object* object, void(Base::*method)(ParamPack...))
+     *  \brief      The constructor binds a method to an instance.
+     *  \tparam     Object passes the instance's typename.
+     *  \tparam     Base passes the method's implementation class.
+     *  \param[in]  object passes a pointer to the instance.
+     *  \param[in]  method passes a method pointer to bind.
+     */
+    template<class Object, class Base>
+    requires std::is_base_of_v<Base, Object>
+    Delegate(Object* object, void(Base::*method)(ParamPack...)) :
+            Delegate(MethodCall<Base>{object, method})
+    {}
+
+    /**
+     *  \fn         Delegate(Object* object, void(Base::*method)(Batch<ParamPack...>))
+     *  \brief      The constructor binds a batch method to an instance.
+     *  \tparam     Object passes the instance's typename.
+     *  \tparam     Base passes the method's implementation class.
+     *  \param[in]  object passes a pointer to the instance.
+     *  \param[in]  method passes a method pointer to bind.
+     */
+    template<class Object, class Base>
+    requires std::is_base_of_v<Base, Object>
+    Delegate(Object* object, void(Base::*method)(Batch<ParamPack...>)) :
+            Delegate(BatchMethodCall<Base>{object, method})
+    {}
+
+    /**
+     *  \fn         bind(Object* object)
+     *  \brief      Binds a method given at compile time to an instance.
+     *  \note       Only the instance pointer is stored, the method is part of the invoker.
+     *  \tparam     Method passes a method pointer taking the parameter pack or a Batch of it.
+     *  \tparam     Object passes the instance's typename.
+     *  \param[in]  object passes a pointer to the instance.
+     *  \return     Delegate calling the method on the instance.
+     */
+    template<auto Method, class Object>
+    requires std::is_invocable_v<decltype(Method), Object*, ParamPack...> ||
+             std::is_invocable_v<decltype(Method), Object*, Batch<ParamPack...>>
+    static Delegate bind(Object* object)
+    {
+        return Delegate(BoundCall<Method, Object>{object});
+    }
+
+    /**
+     *  \fn         operator()(Argument<ParamPack>... args)
+     *  \brief      Calls the stored callable.
+     *  \param[in]  args passes the callable's argument list.
+     */
+    void operator()(Argument<ParamPack>... args)
+    {
+        _invoke(_storage, std::forward<ParamPack>(args)...);
+    }
+
+    /**
+     *  \fn         callBatch(Batch<ParamPack...> batch)
+     *  \brief      Calls the stored callable for all argument sets of a batch.
+     *  \note       The loop over the batch runs inside the type-specific invoker, so the callable
+     *              is called directly. Batch slots receive the whole batch in a single call.
+     *  \param[in]  batch passes the argument sets.
+     */
+    void callBatch(Batch<ParamPack...> batch)
+    {
+        _invokeBatch(_storage, batch);
+    }
+
+    /**
+     *  \fn         operator bool(void) const
+     *  \brief      Checks if the delegate stores a callable.
+     *  \return     Boolean indicating if a callable is stored.
+     */
+    explicit operator bool(void) const
+    {
+        return _invoke != nullptr;
+    }
+
+    /**
+     *  \fn         operator==(const Delegate& other) const
+     *  \brief      Checks if two delegates store the same callable with equal state.
+     *  \note       The stored bytes are compared, which only works for callables satisfying
+     *              isComparable.
+     *  \param[in]  other passes the delegate to compare with.
+     *  \return     Boolean indicating result of check.
+     */
+    bool operator==(const Delegate& other) const
+    {
+        return _invoke == other._invoke && std::memcmp(_storage, other._storage, Size) == 0;
+    }
+
+private:
+    /**
+     *  \struct MethodCall
+     *  \brief  The struct binds a method to an instance.
+     *  \tparam Base passes the method's implementation class.
+     */
+    template<class Base>
+    struct MethodCall
+    {
+        /**
+         *  \var    object
+         *  \brief  Pointer to the instance.
+         */
+        Base* object;
+
+        /**
+         *  \var    method
+         *  \brief  Method pointer to call.
+         */
+        void(Base::*method)(ParamPack...);
+
+        /**
+         *  \fn         operator()(Argument<ParamPack>... args) const
+         *  \brief      Calls the method on the instance.
+         *  \param[in]  args passes the method's argument list.
+         */
+        void operator()(Argument<ParamPack>... args) const
+        {
+            (object->*method)(std::forward<ParamPack>(args)...);
+        }
+    };
+
+    /**
+     *  \struct BatchMethodCall
+     *  \brief  The struct binds a batch method to an instance.
+     *  \tparam Base passes the method's implementation class.
+     */
+    template<class Base>
+    struct BatchMethodCall
+    {
+        /**
+         *  \var    object
+         *  \brief  Pointer to the instance.
+         */
+        Base* object;
+
+        /**
+         *  \var    method
+         *  \brief  Method pointer to call.
+         */
+        void(Base::*method)(Batch<ParamPack...>);
+
+        /**
+         *  \fn         operator()(Batch<ParamPack...> batch) const
+         *  \brief      Calls the method on the instance.
+         *  \param[in]  batch passes the argument sets.
+         */
+        void operator()(Batch<ParamPack...> batch) const
+        {
+            (object->*method)(batch);
+        }
+    };
+
+    /**
+     *  \struct BoundCall
+     *  \brief  The struct binds a method given at compile time to an instance.
+     *  \tparam Method passes the method pointer to call.
+     *  \tparam Object passes the instance's typename.
+     */
+    template<auto Method, class Object>
+    struct BoundCall
+    {
+        /**
+         *  \var    object
+         *  \brief  Pointer to the instance.
+         */
+        Object* object;
+
+        /**
+         *  \fn         operator()(Args&&... args) const
+         *  \brief      Calls the method on the instance.
+         *  \param[in]  args passes the method's argument list or a batch.
+         */
+        template<class... Args>
+        requires std::is_invocable_v<decltype(Method), Object*, Args...>
+        void operator()(Args&&... args) const
+        {
+            (object->*Method)(std::forward<Args>(args)...);
+        }
+    };
+
+    /**
+     *  \fn         invokeCallable(void* storage, Argument<ParamPack>... args)
+     *  \brief      Calls a callable of a specific type stored inside a delegate.
+     *  \tparam     Callable passes the callable's typename.
+     *  \param[in]  storage passes a pointer to the delegate's inline storage.
+     *  \param[in]  args passes the callable's argument list.
+     */
+    template<class Callable>
+    static void invokeCallable(void* storage, Argument<ParamPack>... args)
+    {
+        (*std::launder(static_cast<Callable*>(storage)))(std::forward<ParamPack>(args)...);
+    }
+
+    /**
+     *  \fn         invokeEach(void* storage, Batch<ParamPack...> batch)
+     *  \brief      Calls a callable of a specific type once per argument set of a batch.
+     *  \tparam     Callable passes the callable's typename.
+     *  \param[in]  storage passes a pointer to the delegate's inline storage.
+     *  \param[in]  batch passes the argument sets.
+     */
+    template<class Callable>
+    static void invokeEach(void* storage, Batch<ParamPack...> batch)
+    {
+        Callable& callable = *std::launder(static_cast<Callable*>(storage));
+
+        for (const BatchElement<ParamPack...>& element : batch)
+        {
+            BatchTraits<ParamPack...>::invoke(callable, element);
+        }
+    }
+
+    /**
+     *  \fn         invokeSingle(void* storage, Argument<ParamPack>... args)
+     *  \brief      Calls a batch callable of a specific type with a batch of one argument set.
+     *  \tparam     Callable passes the callable's typename.
+     *  \param[in]  storage passes a pointer to the delegate's inline storage.
+     *  \param[in]  args passes the callable's argument list.
+     */
+    template<class Callable>
+    static void invokeSingle(void* storage, Argument<ParamPack>... args)
+    {
+        const BatchElement<ParamPack...> element{std::forward<ParamPack>(args)...};
+
+        (*std::launder(static_cast<Callable*>(storage)))(Batch<ParamPack...>(&element, 1));
+    }
+
+    /**
+     *  \fn         invokeBatch(void* storage, Batch<ParamPack...> batch)
+     *  \brief      Calls a batch callable of a specific type with a whole batch.
+     *  \tparam     Callable passes the callable's typename.
+     *  \param[in]  storage passes a pointer to the delegate's inline storage.
+     *  \param[in]  batch passes the argument sets.
+     */
+    template<class Callable>
+    static void invokeBatch(void* storage, Batch<ParamPack...> batch)
+    {
+        (*std::launder(static_cast<Callable*>(storage)))(batch);
+    }
+
+    /**
+     *  \var    _storage
+     *  \brief  Inline storage of the callable.
+     */
+    alignas(Alignment) unsigned char _storage[Size]{};
+
+    /**
+     *  \var    _invoke
+     *  \brief  Function calling the stored callable.
+     */
+    void (*_invoke)(void* storage, Argument<ParamPack>... args) = nullptr;
+
+    /**
+     *  \var    _invokeBatch
+     *  \brief  Function calling the stored callable for a batch, nullptr if the signature
+     *          cannot be emitted in batches.
+     */
+    void (*_invokeBatch)(void* storage, Batch<ParamPack...> batch) = nullptr;
+};
+
+#endif //DELEGATE_HPP
\ No newline at end of file
@@ -0,0 +1,384 @@
+/**
+ *  \file   deliveryPolicy.hpp
+ *  \brief  The file implements policies filtering the slot calls of a connection.
+ */
+
+#ifndef DELIVERY_POLICY_HPP
+#define DELIVERY_POLICY_HPP
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "argument.hpp"
+#include "clock.hpp"
+#include "delegate.hpp"
+#include "eventQueue.hpp"
+
+/**
+ *  \class  DeliveryPolicy
+ *  \brief  The class decides whether an emit reaches a connection's slot.
+ *  \details A policy is evaluated by the emitting context before the slot is called or its
+ *          call is queued, so dropped values cost a single check. Policies are owned by the
+ *          application, must outlive their connections and may be shared by connections of
+ *          the same signature to filter them together.
+ *  \tparam ParamPack passes the signal's and slot's parameter pack.
+ */
+template<class... ParamPack>
+class DeliveryPolicy
+{
+public:
+    DeliveryPolicy(const DeliveryPolicy&) = delete;
+    DeliveryPolicy& operator=(const DeliveryPolicy&) = delete;
+
+    /**
+     *  \fn         admit(const Delegate<ParamPack...>& slot, EventQueueBase* queue, const std::decay_t<ParamPack>&... args)
+     *  \brief      Evaluates the policy for an emit.
+     *  \param[in]  slot passes the connection's slot.
+     *  \param[in]  queue passes the queue of a queued connection or nullptr for a direct one.
+     *  \param[in]  args passes the emitted arguments.
+     *  \return     Boolean indicating if the connection delivers the emit itself.
+     */
+    bool admit(const Delegate<ParamPack...>& slot, EventQueueBase* queue, const std::decay_t<ParamPack>&... args)
+    {
+        return _admit(this, slot, queue, args...);
+    }
+
+    /**
+     *  \fn         eventSize(void) const
+     *  \brief      Returns the storage the policy's own queued calls take inside a queue.
+     *  \return     Size of a queued call in bytes or 0 if the policy posts none.
+     */
+    std::size_t eventSize(void) const
+    {
+        return _eventSize;
+    }
+
+protected:
+    /**
+     *  \typedef    Admit
+     *  \brief      Type of the function evaluating a policy.
+     */
+    using Admit = bool (*)(DeliveryPolicy* policy,
+                           const Delegate<ParamPack...>& slot,
+                           EventQueueBase* queue,
+                           const std::decay_t<ParamPack>&... args);
+
+    /**
+     *  \fn         DeliveryPolicy(Admit admit, std::size_t eventSize)
+     *  \brief      The constructor initializes the policy.
+     *  \param[in]  admit passes the function evaluating the derived policy.
+     *  \param[in]  eventSize passes the storage of the policy's own queued calls.
+     */
+    DeliveryPolicy(Admit admit, std::size_t eventSize = 0) :
+            _admit(admit),
+            _eventSize(eventSize)
+    {}
+
+private:
+    /**
+     *  \var    _admit
+     *  \brief  Function evaluating the derived policy.
+     */
+    Admit _admit;
+
+    /**
+     *  \var    _eventSize
+     *  \brief  Storage of the policy's own queued calls.
+     */
+    std::size_t _eventSize;
+};
+
+/**
+ *  \class  Throttle
+ *  \brief  The class enforces a minimum interval between the deliveries of a connection.
+ *  \note   Emits inside the interval are dropped. The policy is lock-free and may be
+ *          evaluated from any number of contexts.
+ *  \tparam ParamPack passes the signal's and slot's parameter pack.
+ */
+template<class... ParamPack>
+class Throttle : public DeliveryPolicy<ParamPack...>
+{
+public:
+    /**
+     *  \fn         Throttle(std::uint32_t interval)
+     *  \brief      The constructor initializes the policy.
+     *  \param[in]  interval passes the minimum interval in EMBEDDED_SIGNALS_DEADLINE_CLOCK ticks.
+     */
+    explicit Throttle(std::uint32_t interval) :
+            DeliveryPolicy<ParamPack...>(&admitThrottled),
+            _interval(interval),
+            _last(EMBEDDED_SIGNALS_DEADLINE_CLOCK::now() - interval)
+    {}
+
+private:
+    /**
+     *  \fn         admitThrottled()
+     *  \brief      Admits an emit if the interval since the last delivery has passed.
+     *  \param[in]  policy passes a pointer to the policy.
+     *  \return     Boolean indicating if the emit is delivered.
+     */
+    static bool admitThrottled(DeliveryPolicy<ParamPack...>* policy,
+                               const Delegate<ParamPack...>&,
+                               EventQueueBase*,
+                               const std::decay_t<ParamPack>&...
+    )
+    {
+        Throttle* self = static_cast<Throttle*>(policy);
+        const std::uint32_t now = EMBEDDED_SIGNALS_DEADLINE_CLOCK::now();
+        std::uint32_t last = self->_last.load(std::memory_order_relaxed);
+
+        return now - last >= self->_interval &&
+               self->_last.compare_exchange_strong(last, now, std::memory_order_relaxed);
+    }
+
+    /**
+     *  \var    _interval
+     *  \brief  Minimum interval between two deliveries.
+     */
+    std::uint32_t _interval;
+
+    /**
+     *  \var    _last
+     *  \brief  Clock tick of the last delivery.
+     */
+    std::atomic<std::uint32_t> _last;
+};
+
+/**
+ *  \class  EdgeTrigger
+ *  \brief  The class delivers an emit only if its arguments differ from the last delivered ones.
+ *  \note   The policy keeps a copy of the last arguments and must only be evaluated from a
+ *          single emitting context.
+ *  \tparam ParamPack passes the signal's and slot's parameter pack.
+ */
+template<class... ParamPack>
+requires std::equality_comparable<std::tuple<std::decay_t<ParamPack>...>>
+class EdgeTrigger : public DeliveryPolicy<ParamPack...>
+{
+public:
+    /**
+     *  \fn     EdgeTrigger(void)
+     *  \brief  The constructor initializes a policy delivering the first emit.
+     */
+    EdgeTrigger(void) :
+            DeliveryPolicy<ParamPack...>(&admitChanged)
+    {}
+
+private:
+    /**
+     *  \fn         admitChanged()
+     *  \brief      Admits an emit if its arguments changed.
+     *  \param[in]  policy passes a pointer to the policy.
+     *  \param[in]  args passes the emitted arguments.
+     *  \return     Boolean indicating if the emit is delivered.
+     */
+    static bool admitChanged(DeliveryPolicy<ParamPack...>* policy,
+                             const Delegate<ParamPack...>&,
+                             EventQueueBase*,
+                             const std::decay_t<ParamPack>&... args
+    )
+    {
+        EdgeTrigger* self = static_cast<EdgeTrigger*>(policy);
+
+        if (self->_primed && self->_last == std::tie(args...))
+        {
+            return false;
+        }
+
+        self->_last = std::tie(args...);
+        self->_primed = true;
+
+        return true;
+    }
+
+    /**
+     *  \var    _last
+     *  \brief  Copies of the last delivered arguments.
+     */
+    std::tuple<std::decay_t<ParamPack>...> _last{};
+
+    /**
+     *  \var    _primed
+     *  \brief  Boolean indicating if an emit was delivered before.
+     */
+    bool _primed = false;
+};
+
+/**
+ *  \class  Coalesce
+ *  \brief  The class merges the emits of a queued connection into its next queued call.
+ *  \details Only one call is pending at a time and it delivers the newest arguments at the
+ *          moment it is dispatched, so a receiver dispatching its queue at 50 Hz receives
+ *          at most 50 calls per second regardless of the emit rate. The arguments are
+ *          exchanged through a triple buffer without locks.
+ *  \note   The policy must only be evaluated from a single emitting context. Direct
+ *          connections are delivered unchanged.
+ *  \tparam ParamPack passes the signal's and slot's parameter pack.
+ */
+template<class... ParamPack>
+class Coalesce : public DeliveryPolicy<ParamPack...>
+{
+public:
+    /**
+     *  \fn     Coalesce(void)
+     *  \brief  The constructor initializes a policy without a pending call.
+     */
+    Coalesce(void) :
+            DeliveryPolicy<ParamPack...>(&admitCoalesced, sizeof(Drain))
+    {}
+
+private:
+    /**
+     *  \typedef    Values
+     *  \brief      Type storing copies of the emitted arguments.
+     */
+    using Values = std::tuple<std::decay_t<ParamPack>...>;
+
+    /**
+     *  \var    Dirty
+     *  \brief  Flag of the shared buffer index marking unread arguments.
+     */
+    static constexpr std::uint8_t Dirty = 0x4;
+
+    /**
+     *  \struct Drain
+     *  \brief  The struct represents the pending call delivering the newest arguments.
+     *  \note   A call dropped by its queue releases the pending state as well.
+     */
+    struct Drain
+    {
+        /**
+         *  \fn         Drain(Coalesce* policy, const Delegate<ParamPack...>& slot)
+         *  \brief      The constructor initializes the call.
+         *  \param[in]  policy passes a pointer to the policy.
+         *  \param[in]  slot passes the connection's slot.
+         */
+        Drain(Coalesce* policy, const Delegate<ParamPack...>& slot) :
+                policy(policy),
+                slot(slot)
+        {}
+
+        /**
+         *  \fn         Drain(Drain&& other)
+         *  \brief      The constructor takes over the pending state of another call.
+         *  \param[in]  other passes the call to move.
+         */
+        Drain(Drain&& other) :
+                policy(std::exchange(other.policy, nullptr)),
+                slot(other.slot)
+        {}
+
+        /**
+         *  \fn     ~Drain(void)
+         *  \brief  Releases the pending state if the call was not executed.
+         */
+        ~Drain(void)
+        {
+            if (policy)
+            {
+                policy->_pending.store(false, std::memory_order_release);
+            }
+        }
+
+        /**
+         *  \fn     operator()(void)
+         *  \brief  Calls the slot with the newest arguments if there are any.
+         */
+        void operator()(void)
+        {
+            Coalesce* self = std::exchange(policy, nullptr);
+
+            self->_pending.store(false, std::memory_order_seq_cst);
+
+            if (self->_middle.load(std::memory_order_acquire) & Dirty)
+            {
+                self->_front = static_cast<std::uint8_t>(self->_middle.exchange(self->_front, std::memory_order_acq_rel) & ~Dirty);
+
+                std::apply([this](auto&... values) { slot(passArgument<ParamPack, true>(values)...); },
+                           self->_buffers[self->_front]);
+            }
+        }
+
+        /**
+         *  \var    policy
+         *  \brief  Pointer to the policy or nullptr once the call released the pending state.
+         */
+        Coalesce* policy;
+
+        /**
+         *  \var    slot
+         *  \brief  Callable of the receiver's slot.
+         */
+        Delegate<ParamPack...> slot;
+    };
+
+    /**
+     *  \fn         admitCoalesced()
+     *  \brief      Publishes the arguments and posts a call unless one is pending.
+     *  \param[in]  policy passes a pointer to the policy.
+     *  \param[in]  slot passes the connection's slot.
+     *  \param[in]  queue passes the queue of a queued connection or nullptr for a direct one.
+     *  \param[in]  args passes the emitted arguments.
+     *  \return     Boolean indicating if the connection delivers the emit itself.
+     */
+    static bool admitCoalesced(DeliveryPolicy<ParamPack...>* policy,
+                               const Delegate<ParamPack...>& slot,
+                               EventQueueBase* queue,
+                               const std::decay_t<ParamPack>&... args
+    )
+    {
+        if (!queue)
+        {
+            return true;
+        }
+
+        Coalesce* self = static_cast<Coalesce*>(policy);
+
+        self->_buffers[self->_back] = std::tie(args...);
+        self->_back = static_cast<std::uint8_t>(self->_middle.exchange(self->_back | Dirty, std::memory_order_acq_rel) & ~Dirty);
+
+        if (!self->_pending.exchange(true, std::memory_order_seq_cst))
+        {
+            queue->post(Drain(self, slot));
+        }
+
+        return false;
+    }
+
+    /**
+     *  \var    _buffers
+     *  \brief  Triple buffer of argument copies.
+     */
+    Values _buffers[3]{};
+
+    /**
+     *  \var    _middle
+     *  \brief  Index of the shared buffer and the dirty flag.
+     */
+    std::atomic<std::uint8_t> _middle = 1;
+
+    /**
+     *  \var    _back
+     *  \brief  Index of the buffer written by the emitting context.
+     */
+    std::uint8_t _back = 0;
+
+    /**
+     *  \var    _front
+     *  \brief  Index of the buffer read by the receiver's queue.
+     */
+    std::uint8_t _front = 2;
+
+    /**
+     *  \var    _pending
+     *  \brief  Boolean indicating if a call is queued.
+     */
+    std::atomic<bool> _pending = false;
+};
+
+#endif //DELIVERY_POLICY_HPP
\ No newline at end of file
@@ -0,0 +1,454 @@
+/**
+ *  \file   eventQueue.hpp
+ *  \brief  The file implements a fixed-size queue of deferred slot calls.
+ */
+
+#ifndef EVENT_QUEUE_HPP
+#define EVENT_QUEUE_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifndef EMBEDDED_SIGNALS_EVENT_SIZE
+/**
+ *  \def    EMBEDDED_SIGNALS_EVENT_SIZE
+ *  \brief  Default number of bytes available to store a single queued event.
+ */
+#define EMBEDDED_SIGNALS_EVENT_SIZE (16 * sizeof(void*))
+#endif
+
+/**
+ *  \enum   OverflowPolicy
+ *  \brief  The enum describes how a full event queue treats new events.
+ */
+enum class OverflowPolicy : std::uint8_t
+{
+    DropNewest,
+    DropOldest
+};
+
+/**
+ *  \class  EventQueueBase
+ *  \brief  The class implements a lock-free multi-producer ring buffer of deferred calls.
+ *  \details Events can be posted from any context including interrupt handlers, while a
+ *          single consumer, e.g. the main loop or an RTOS task, dispatches them.
+ *          The storage is provided by the derived EventQueue class.
+ */
+class EventQueueBase
+{
+public:
+    EventQueueBase(const EventQueueBase&) = delete;
+    EventQueueBase& operator=(const EventQueueBase&) = delete;
+
+    /**
+     *  \fn         post(Function&& function)
+     *  \brief      Copies a callable into the queue for deferred execution.
+     *  \tparam     Function passes the callable's typename.
+     *  \param[in]  function passes the callable to execute later.
+     *  \return     Boolean indicating if the event could be queued.
+     */
+    template<class Function>
+    bool post(Function&& function)
+    {
+        using Event = std::decay_t<Function>;
+
+        static_assert(alignof(Event) <= alignof(std::max_align_t), "Over-aligned events are not supported.");
+
+        if (sizeof(Event) > _eventSize)
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        std::size_t position = 0;
+        EventHeader* header = reserve(position);
+
+        if (!header)
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+
+            if (_notify)
+            {
+                _notify(_context);
+            }
+
+            return false;
+        }
+
+        new (payloadOf(header)) Event(std::forward<Function>(function));
+        header->dispatch = [](void* payload, bool invoke)
+        {
+            Event* event = static_cast<Event*>(payload);
+
+            if (invoke)
+            {
+                (*event)();
+            }
+
+            event->~Event();
+        };
+        header->sequence.store(position + 1, std::memory_order_release);
+
+        if (_notify)
+        {
+            _notify(_context);
+        }
+
+        return true;
+    }
+
+    /**
+     *  \fn         dispatch(std::size_t maximum)
+     *  \brief      Executes queued events in the order they were posted.
+     *  \note       The function must only be called from a single context at a time.
+     *  \param[in]  maximum passes the maximum number of events to execute.
+     *  \return     Number of executed events.
+     */
+    std::size_t dispatch(std::size_t maximum = SIZE_MAX)
+    {
+        std::size_t count = 0;
+
+        while (count < maximum && pop(true))
+        {
+            count++;
+        }
+
+        return count;
+    }
+
+    /**
+     *  \fn         empty(void) const
+     *  \brief      Checks if no event is ready to be dispatched.
+     *  \return     Boolean indicating result of check.
+     */
+    bool empty(void) const
+    {
+        const std::size_t position = _dequeue.load(std::memory_order_relaxed);
+
+        return headerAt(position)->sequence.load(std::memory_order_acquire) != position + 1;
+    }
+
+    /**
+     *  \fn         dropped(void) const
+     *  \brief      Returns the number of events lost due to overflow.
+     *  \return     Number of dropped events.
+     */
+    std::size_t dropped(void) const
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn         eventSize(void) const
+     *  \brief      Returns the number of bytes available to store a single event.
+     *  \return     Size of an event's storage.
+     */
+    std::size_t eventSize(void) const
+    {
+        return _eventSize;
+    }
+
+    /**
+     *  \fn         strideOf(std::size_t eventSize)
+     *  \brief      Computes the distance in bytes between two events of a ring buffer.
+     *  \param[in]  eventSize passes the number of bytes available per event.
+     *  \return     Distance between two events.
+     */
+    static constexpr std::size_t strideOf(std::size_t eventSize)
+    {
+        return PayloadOffset + (eventSize + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+    }
+
+protected:
+    /**
+     *  \fn         EventQueueBase()
+     *  \brief      The constructor initializes the ring buffer inside the passed storage.
+     *  \param[in]  storage passes the ring buffer's memory.
+     *  \param[in]  capacity passes the number of events, which must be a power of two.
+     *  \param[in]  stride passes the distance in bytes between two events.
+     *  \param[in]  eventSize passes the number of bytes available per event.
+     *  \param[in]  policy passes the queue's overflow policy.
+     */
+    EventQueueBase(unsigned char* storage,
+                   std::size_t capacity,
+                   std::size_t stride,
+                   std::size_t eventSize,
+                   OverflowPolicy policy
+    ) :
+            _storage(storage),
+            _mask(capacity - 1),
+            _stride(stride),
+            _eventSize(eventSize),
+            _policy(policy)
+    {
+        for (std::size_t position = 0; position < capacity; position++)
+        {
+            EventHeader* header = new (storage + position * stride) EventHeader{};
+            header->sequence.store(position, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  \fn         setNotification(void (*notify)(void* context), void* context)
+     *  \brief      Assigns a function called whenever an event was posted.
+     *  \note       The function must be assigned before events are posted and is called
+     *              from the posting context. It is called for events rejected by a full
+     *              queue as well, so a consumer that missed a notification catches up.
+     *  \param[in]  notify passes the function to call or nullptr.
+     *  \param[in]  context passes the argument of the function.
+     */
+    void setNotification(void (*notify)(void* context), void* context)
+    {
+        _notify = notify;
+        _context = context;
+    }
+
+    /**
+     *  \fn         ~EventQueueBase(void)
+     *  \brief      Destroys the queue and discards all pending events.
+     */
+    ~EventQueueBase(void)
+    {
+        while (pop(false));
+    }
+
+private:
+    /**
+     *  \struct EventHeader
+     *  \brief  The struct precedes each event's storage inside the ring buffer.
+     */
+    struct EventHeader
+    {
+        /**
+         *  \var    sequence
+         *  \brief  Sequence number synchronizing the producers and the consumer.
+         */
+        std::atomic<std::size_t> sequence;
+
+        /**
+         *  \var    dispatch
+         *  \brief  Function executing or discarding the stored event.
+         */
+        void (*dispatch)(void* payload, bool invoke);
+    };
+
+    /**
+     *  \var    PayloadOffset
+     *  \brief  Offset of the event's storage relative to its header.
+     */
+    static constexpr std::size_t PayloadOffset =
+            (sizeof(EventHeader) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    /**
+     *  \fn         headerAt(std::size_t position) const
+     *  \brief      Returns the header of the event at the passed ring position.
+     *  \param[in]  position passes the unwrapped ring position.
+     *  \return     Pointer to the event's header.
+     */
+    EventHeader* headerAt(std::size_t position) const
+    {
+        return std::launder(reinterpret_cast<EventHeader*>(_storage + (position & _mask) * _stride));
+    }
+
+    /**
+     *  \fn         payloadOf(EventHeader* header)
+     *  \brief      Returns the storage of an event.
+     *  \param[in]  header passes a pointer to the event's header.
+     *  \return     Pointer to the event's storage.
+     */
+    static void* payloadOf(EventHeader* header)
+    {
+        return reinterpret_cast<unsigned char*>(header) + PayloadOffset;
+    }
+
+    /**
+     *  \fn         reserve(std::size_t& position)
+     *  \brief      Claims a free event for a producer.
+     *  \note       With OverflowPolicy::DropOldest, a single event is dropped per call. If the
+     *              slot is still busy afterwards, e.g. because the consumer is dispatching the
+     *              oldest event, the call fails instead of draining further events.
+     *  \param[out] position returns the unwrapped ring position of the claimed event.
+     *  \return     Pointer to the event's header or nullptr if the queue is full.
+     */
+    EventHeader* reserve(std::size_t& position)
+    {
+        bool dropped = false;
+
+        position = _enqueue.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            EventHeader* header = headerAt(position);
+            const std::size_t sequence = header->sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    return header;
+                }
+            }
+            else if (difference < 0)
+            {
+                if (_policy != OverflowPolicy::DropOldest || dropped || !pop(false))
+                {
+                    return nullptr;
+                }
+
+                dropped = true;
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                position = _enqueue.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                position = _enqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     *  \fn         pop(bool invoke)
+     *  \brief      Removes the oldest event from the queue.
+     *  \param[in]  invoke passes whether to execute or to discard the event.
+     *  \return     Boolean indicating if an event was removed.
+     */
+    bool pop(bool invoke)
+    {
+        std::size_t position = _dequeue.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            EventHeader* header = headerAt(position);
+            const std::size_t sequence = header->sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+
+            if (difference == 0)
+            {
+                if (_dequeue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    header->dispatch(payloadOf(header), invoke);
+                    header->sequence.store(position + _mask + 1, std::memory_order_release);
+
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = _dequeue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     *  \var    _storage
+     *  \brief  Pointer to the ring buffer's memory.
+     */
+    unsigned char* _storage;
+
+    /**
+     *  \var    _mask
+     *  \brief  Mask wrapping ring positions to event indices.
+     */
+    std::size_t _mask;
+
+    /**
+     *  \var    _stride
+     *  \brief  Distance in bytes between two events.
+     */
+    std::size_t _stride;
+
+    /**
+     *  \var    _eventSize
+     *  \brief  Number of bytes available to store a single event.
+     */
+    std::size_t _eventSize;
+
+    /**
+     *  \var    _policy
+     *  \brief  Overflow policy of the queue.
+     */
+    OverflowPolicy _policy;
+
+    /**
+     *  \var    _enqueue
+     *  \brief  Next ring position claimed by a producer.
+     */
+    std::atomic<std::size_t> _enqueue = 0;
+
+    /**
+     *  \var    _dequeue
+     *  \brief  Next ring position taken by the consumer.
+     */
+    std::atomic<std::size_t> _dequeue = 0;
+
+    /**
+     *  \var    _dropped
+     *  \brief  Number of events lost due to overflow.
+     */
+    std::atomic<std::size_t> _dropped = 0;
+
+    /**
+     *  \var    _notify
+     *  \brief  Function called whenever an event was posted or rejected by a full queue.
+     */
+    void (*_notify)(void* context) = nullptr;
+
+    /**
+     *  \var    _context
+     *  \brief  Argument of the notification function.
+     */
+    void* _context = nullptr;
+};
+
+/**
+ *  \struct EventQueueStorage
+ *  \brief  The struct holds the memory of an event queue's ring buffer.
+ *  \tparam Size passes the ring buffer's size in bytes.
+ */
+template<std::size_t Size>
+struct EventQueueStorage
+{
+    /**
+     *  \var    storage
+     *  \brief  Memory of the ring buffer.
+     */
+    alignas(std::max_align_t) unsigned char storage[Size];
+};
+
+/**
+ *  \class  EventQueue
+ *  \brief  The class provides the statically allocated storage of an event queue.
+ *  \tparam Capacity passes the number of events, which must be a power of two.
+ *  \tparam EventSize passes the number of bytes available to store a single event.
+ *  \tparam Policy passes the queue's overflow policy.
+ */
+template<std::size_t Capacity,
+         std::size_t EventSize = EMBEDDED_SIGNALS_EVENT_SIZE,
+         OverflowPolicy Policy = OverflowPolicy::DropNewest>
+class EventQueue :
+        private EventQueueStorage<Capacity * EventQueueBase::strideOf(EventSize)>,
+        public EventQueueBase
+{
+    static_assert(std::has_single_bit(Capacity), "The queue capacity must be a power of two.");
+
+public:
+    /**
+     *  \fn         EventQueue(void)
+     *  \brief      The constructor initializes an empty queue.
+     */
+    EventQueue(void) :
+            EventQueueBase(this->storage, Capacity, strideOf(EventSize), EventSize, Policy)
+    {}
+};
+
+#endif //EVENT_QUEUE_HPP
\ No newline at end of file
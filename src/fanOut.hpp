@@ -0,0 +1,352 @@
+/**
+ *  \file   fanOut.hpp
+ *  \brief  The file implements a thread pool splitting the slots of a single emit into chunks.
+ *  \note   The pool requires std::thread and is meant for hosted multi-core targets.
+ */
+
+#ifndef FAN_OUT_HPP
+#define FAN_OUT_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+/**
+ *  \class  FanOutBase
+ *  \brief  The class implements a pool of threads executing the chunks of a fan-out.
+ *  \details A fan-out splits a range of items into one chunk per worker and the calling
+ *          thread, which takes part in the execution. Idle threads take further chunks until
+ *          the range is done, the caller returns once every item is executed.
+ *          A fan-out started while another one runs, e.g. from inside a chunk, is executed by
+ *          the calling thread alone, so the pool never deadlocks.
+ *          The storage is provided by the derived FanOut class.
+ */
+class FanOutBase
+{
+public:
+    FanOutBase(const FanOutBase&) = delete;
+    FanOutBase& operator=(const FanOutBase&) = delete;
+
+    /**
+     *  \fn         run(std::size_t count, Task&& task)
+     *  \brief      Executes a range of items on all workers and the calling thread.
+     *  \tparam     Task passes the typename of the callable executing a chunk.
+     *  \param[in]  count passes the number of items.
+     *  \param[in]  task passes the callable, which receives the begin and end of a chunk.
+     */
+    template<class Task>
+    void run(std::size_t count, Task&& task)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (count == 1 || _running.exchange(true, std::memory_order_acquire))
+        {
+            task(std::size_t{0}, count);
+
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            _idle.wait(lock, [this]{ return _busy == 0; });
+
+            _context = &task;
+            _call = &execute<std::remove_reference_t<Task>>;
+            _count = count;
+            _chunk = (count + _workers) / (_workers + 1);
+            _next.store(0, std::memory_order_relaxed);
+            _finished.store(0, std::memory_order_relaxed);
+            _generation++;
+        }
+        _wakeup.notify_all();
+
+        process(&task, &execute<std::remove_reference_t<Task>>, count, _chunk);
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            _idle.wait(lock, [this, count]{ return _finished.load(std::memory_order_acquire) == count; });
+        }
+
+        _running.store(false, std::memory_order_release);
+    }
+
+    /**
+     *  \fn     workers(void) const
+     *  \brief  Returns the number of worker threads.
+     *  \return Number of workers.
+     */
+    std::size_t workers(void) const
+    {
+        return _workers;
+    }
+
+protected:
+    /**
+     *  \fn         FanOutBase(std::thread* threads, std::size_t workers)
+     *  \brief      The constructor initializes the pool inside the passed storage.
+     *  \param[in]  threads passes the array of worker threads.
+     *  \param[in]  workers passes the number of workers.
+     */
+    FanOutBase(std::thread* threads, std::size_t workers) :
+            _threads(threads),
+            _workers(workers)
+    {}
+
+    /**
+     *  \fn     start(void)
+     *  \brief  Starts the worker threads.
+     *  \note   The function is called once the derived class constructed the storage.
+     */
+    void start(void)
+    {
+        for (std::size_t index = 0; index < _workers; index++)
+        {
+            _threads[index] = std::thread(&FanOutBase::work, this);
+        }
+    }
+
+    /**
+     *  \fn     stop(void)
+     *  \brief  Joins the worker threads.
+     */
+    void stop(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _wakeup.notify_all();
+
+        for (std::size_t index = 0; index < _workers; index++)
+        {
+            _threads[index].join();
+        }
+    }
+
+private:
+    /**
+     *  \fn         execute(void* context, std::size_t begin, std::size_t end)
+     *  \brief      Calls the typed task of a fan-out for a chunk.
+     *  \tparam     Task passes the typename of the callable executing a chunk.
+     *  \param[in]  context passes a pointer to the task.
+     *  \param[in]  begin passes the first item of the chunk.
+     *  \param[in]  end passes the item behind the chunk.
+     */
+    template<class Task>
+    static void execute(void* context, std::size_t begin, std::size_t end)
+    {
+        (*static_cast<Task*>(context))(begin, end);
+    }
+
+    /**
+     *  \fn         process(void* context, void (*call)(void*, std::size_t, std::size_t), std::size_t count, std::size_t chunk)
+     *  \brief      Executes chunks of the current fan-out until none is left.
+     *  \param[in]  context passes a pointer to the task.
+     *  \param[in]  call passes the function calling the task.
+     *  \param[in]  count passes the number of items.
+     *  \param[in]  chunk passes the number of items per chunk.
+     */
+    void process(void* context, void (*call)(void*, std::size_t, std::size_t), std::size_t count, std::size_t chunk)
+    {
+        while (true)
+        {
+            const std::size_t begin = _next.fetch_add(chunk, std::memory_order_relaxed);
+
+            if (begin >= count)
+            {
+                return;
+            }
+
+            const std::size_t end = begin + chunk < count ? begin + chunk : count;
+
+            call(context, begin, end);
+
+            if (_finished.fetch_add(end - begin, std::memory_order_acq_rel) + (end - begin) == count)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _idle.notify_all();
+            }
+        }
+    }
+
+    /**
+     *  \fn     work(void)
+     *  \brief  Executes the chunks of each started fan-out until the pool is stopped.
+     */
+    void work(void)
+    {
+        std::uint32_t generation = 0;
+
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            _wakeup.wait(lock, [this, generation]{ return _stopping || _generation != generation; });
+
+            if (_stopping)
+            {
+                break;
+            }
+
+            generation = _generation;
+
+            void* const context = _context;
+            void (*const call)(void*, std::size_t, std::size_t) = _call;
+            const std::size_t count = _count;
+            const std::size_t chunk = _chunk;
+
+            _busy++;
+            lock.unlock();
+
+            process(context, call, count, chunk);
+
+            lock.lock();
+
+            if (--_busy == 0)
+            {
+                _idle.notify_all();
+            }
+        }
+    }
+
+    /**
+     *  \var    _threads
+     *  \brief  Pointer to the array of worker threads.
+     */
+    std::thread* _threads;
+
+    /**
+     *  \var    _workers
+     *  \brief  Number of workers.
+     */
+    std::size_t _workers;
+
+    /**
+     *  \var    _context
+     *  \brief  Pointer to the task of the current fan-out.
+     */
+    void* _context = nullptr;
+
+    /**
+     *  \var    _call
+     *  \brief  Function calling the task of the current fan-out.
+     */
+    void (*_call)(void* context, std::size_t begin, std::size_t end) = nullptr;
+
+    /**
+     *  \var    _count
+     *  \brief  Number of items of the current fan-out.
+     */
+    std::size_t _count = 0;
+
+    /**
+     *  \var    _chunk
+     *  \brief  Number of items per chunk of the current fan-out.
+     */
+    std::size_t _chunk = 0;
+
+    /**
+     *  \var    _next
+     *  \brief  First item not yet taken by a thread.
+     */
+    std::atomic<std::size_t> _next = 0;
+
+    /**
+     *  \var    _finished
+     *  \brief  Number of executed items.
+     */
+    std::atomic<std::size_t> _finished = 0;
+
+    /**
+     *  \var    _running
+     *  \brief  Boolean indicating if a fan-out is in progress.
+     */
+    std::atomic<bool> _running = false;
+
+    /**
+     *  \var    _generation
+     *  \brief  Number of started fan-outs, which wakes the workers.
+     */
+    std::uint32_t _generation = 0;
+
+    /**
+     *  \var    _busy
+     *  \brief  Number of workers holding a fan-out, which must not be replaced meanwhile.
+     */
+    std::size_t _busy = 0;
+
+    /**
+     *  \var    _mutex
+     *  \brief  Mutex protecting the current fan-out and the sleep of idle workers.
+     */
+    std::mutex _mutex;
+
+    /**
+     *  \var    _wakeup
+     *  \brief  Condition waking idle workers.
+     */
+    std::condition_variable _wakeup;
+
+    /**
+     *  \var    _idle
+     *  \brief  Condition waking the caller once all items or workers are done.
+     */
+    std::condition_variable _idle;
+
+    /**
+     *  \var    _stopping
+     *  \brief  Boolean indicating if the pool is stopping.
+     */
+    bool _stopping = false;
+};
+
+/**
+ *  \class  FanOut
+ *  \brief  The class provides the statically sized storage of a fan-out pool.
+ *  \note   Pass the pool to SignalObject::fireParallel(). The pool must outlive all emits
+ *          using it.
+ *  \tparam Workers passes the number of worker threads besides the emitting one.
+ */
+template<std::size_t Workers>
+class FanOut : public FanOutBase
+{
+    static_assert(Workers > 0, "Invalid fan-out pool size.");
+
+public:
+    /**
+     *  \fn     FanOut(void)
+     *  \brief  The constructor starts the worker threads.
+     */
+    FanOut(void) :
+            FanOutBase(_storage, Workers)
+    {
+        start();
+    }
+
+    /**
+     *  \fn     ~FanOut(void)
+     *  \brief  Stops the worker threads.
+     */
+    ~FanOut(void)
+    {
+        stop();
+    }
+
+private:
+    /**
+     *  \var    _storage
+     *  \brief  Worker threads of the pool.
+     */
+    std::thread _storage[Workers];
+};
+
+#endif //FAN_OUT_HPP
\ No newline at end of file
@@ -0,0 +1,197 @@
+/**
+ *  \file   footprint.hpp
+ *  \brief  The file implements the memory footprint reports of the connection pools.
+ */
+
+#ifndef FOOTPRINT_HPP
+#define FOOTPRINT_HPP
+
+#include <cstddef>
+#include <span>
+
+/**
+ *  \struct SignatureFootprint
+ *  \brief  The struct reports the memory used by the connections of a single signature.
+ *  \note   All storage is static, the reserved bytes are taken whether used or not. The bytes
+ *          in use tell how far the capacity could be reduced.
+ */
+struct SignatureFootprint
+{
+    /**
+     *  \var    pool
+     *  \brief  Pointer identifying the signature's pool.
+     */
+    const void* pool = nullptr;
+
+    /**
+     *  \var    recordSize
+     *  \brief  Bytes stored per connection, including the dispatch payload.
+     */
+    std::size_t recordSize = 0;
+
+    /**
+     *  \var    entrySize
+     *  \brief  Bytes stored per entry of the signal index.
+     */
+    std::size_t entrySize = 0;
+
+    /**
+     *  \var    connections
+     *  \brief  Number of stored connections.
+     */
+    std::size_t connections = 0;
+
+    /**
+     *  \var    peak
+     *  \brief  Highest number of connections stored at the same time.
+     */
+    std::size_t peak = 0;
+
+    /**
+     *  \var    capacity
+     *  \brief  Maximum number of connections of the signature.
+     */
+    std::size_t capacity = 0;
+
+    /**
+     *  \var    signals
+     *  \brief  Number of used entries of the signal index.
+     */
+    std::size_t signals = 0;
+
+    /**
+     *  \var    bytesInUse
+     *  \brief  Bytes taken by the stored connections and used index entries.
+     */
+    std::size_t bytesInUse = 0;
+
+    /**
+     *  \var    peakBytes
+     *  \brief  Bytes taken by the connections at their peak.
+     */
+    std::size_t peakBytes = 0;
+
+    /**
+     *  \var    bytesReserved
+     *  \brief  Bytes of the signature's static pool.
+     */
+    std::size_t bytesReserved = 0;
+};
+
+/**
+ *  \struct FootprintSource
+ *  \brief  The struct links a connection pool into the global footprint registry.
+ */
+struct FootprintSource
+{
+    /**
+     *  \var    pool
+     *  \brief  Pointer to the pool.
+     */
+    const void* pool;
+
+    /**
+     *  \var    measure
+     *  \brief  Function reporting the footprint of the pool.
+     */
+    void (*measure)(const void* pool, SignatureFootprint& footprint);
+
+    /**
+     *  \var    next
+     *  \brief  Pointer to the next registered source.
+     */
+    FootprintSource* next = nullptr;
+
+    /**
+     *  \var    attached
+     *  \brief  Boolean indicating if the source is registered.
+     */
+    bool attached = false;
+};
+
+/**
+ *  \class  Footprint
+ *  \brief  The class collects the memory footprints of all connection pools.
+ *  \note   A pool registers itself with its first connection, signatures never connected
+ *          are not reported.
+ */
+class Footprint
+{
+public:
+    /**
+     *  \fn         collect(std::span<SignatureFootprint> footprints)
+     *  \brief      Reports the footprints of all registered signatures.
+     *  \note       The function must be called from the context connecting and disconnecting.
+     *  \param[out] footprints returns the footprints of the latest registered signatures first.
+     *  \return     Number of registered signatures, which may exceed the reported ones.
+     */
+    static std::size_t collect(std::span<SignatureFootprint> footprints)
+    {
+        std::size_t count = 0;
+
+        for (FootprintSource* source = _sources; source; source = source->next)
+        {
+            if (count < footprints.size())
+            {
+                source->measure(source->pool, footprints[count]);
+            }
+
+            count++;
+        }
+
+        return count;
+    }
+
+    /**
+     *  \fn     total(void)
+     *  \brief  Sums the footprints of all registered signatures.
+     *  \note   The function must be called from the context connecting and disconnecting.
+     *  \return Footprint of all signatures without a pool.
+     */
+    static SignatureFootprint total(void)
+    {
+        SignatureFootprint sum;
+
+        for (FootprintSource* source = _sources; source; source = source->next)
+        {
+            SignatureFootprint footprint;
+            source->measure(source->pool, footprint);
+
+            sum.connections += footprint.connections;
+            sum.peak += footprint.peak;
+            sum.capacity += footprint.capacity;
+            sum.signals += footprint.signals;
+            sum.bytesInUse += footprint.bytesInUse;
+            sum.peakBytes += footprint.peakBytes;
+            sum.bytesReserved += footprint.bytesReserved;
+        }
+
+        return sum;
+    }
+
+    /**
+     *  \fn         attach(FootprintSource& source)
+     *  \brief      Registers a pool's source once.
+     *  \param[in]  source passes the pool's source.
+     */
+    static void attach(FootprintSource& source)
+    {
+        if (source.attached)
+        {
+            return;
+        }
+
+        source.next = _sources;
+        source.attached = true;
+        _sources = &source;
+    }
+
+private:
+    /**
+     *  \var    _sources
+     *  \brief  Pointer to the first registered source.
+     */
+    inline static FootprintSource* _sources = nullptr;
+};
+
+#endif //FOOTPRINT_HPP
\ No newline at end of file
@@ -0,0 +1,370 @@
+/**
+ *  \file   instrumentation.hpp
+ *  \brief  The file implements optional emit counters and slot latency histograms.
+ *  \note   The instrumentation is only compiled into the connection pools if
+ *          EMBEDDED_SIGNALS_INSTRUMENTATION is defined.
+ */
+
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "clock.hpp"
+
+#ifndef EMBEDDED_SIGNALS_HISTOGRAM_BUCKETS
+/**
+ *  \def    EMBEDDED_SIGNALS_HISTOGRAM_BUCKETS
+ *  \brief  Number of buckets of a slot latency histogram.
+ *  \note   Bucket n counts the calls taking less than 2^n clock ticks, the last bucket
+ *          counts all longer calls.
+ */
+#define EMBEDDED_SIGNALS_HISTOGRAM_BUCKETS 16
+#endif
+
+class SignalObject;
+
+/**
+ *  \struct ConnectionReport
+ *  \brief  The struct reports the statistics of a single connection.
+ */
+struct ConnectionReport
+{
+    /**
+     *  \var    Buckets
+     *  \brief  Number of histogram buckets.
+     */
+    static constexpr std::size_t Buckets = EMBEDDED_SIGNALS_HISTOGRAM_BUCKETS;
+
+    /**
+     *  \var    sender
+     *  \brief  Pointer to the connection's sender instance.
+     */
+    const SignalObject* sender = nullptr;
+
+    /**
+     *  \var    receiver
+     *  \brief  Pointer to the connection's receiver instance or nullptr if there is none.
+     */
+    const SignalObject* receiver = nullptr;
+
+    /**
+     *  \var    emits
+     *  \brief  Number of emits of the connection's sender signal.
+     */
+    std::uint32_t emits = 0;
+
+    /**
+     *  \var    calls
+     *  \brief  Number of measured slot calls.
+     */
+    std::uint32_t calls = 0;
+
+    /**
+     *  \var    total
+     *  \brief  Accumulated clock ticks of all slot calls, saturating at UINT32_MAX.
+     */
+    std::uint32_t total = 0;
+
+    /**
+     *  \var    worst
+     *  \brief  Clock ticks of the longest slot call.
+     */
+    std::uint32_t worst = 0;
+
+    /**
+     *  \var    histogram
+     *  \brief  Number of slot calls per latency bucket.
+     */
+    std::uint32_t histogram[Buckets]{};
+};
+
+/**
+ *  \struct SignalReport
+ *  \brief  The struct reports the cost bound and the longest measured emit of a single signal.
+ *  \note   While the Wiring is frozen, the probes and connections of a signal don't change,
+ *          so an emit never walks more than they tell.
+ */
+struct SignalReport
+{
+    /**
+     *  \var    sender
+     *  \brief  Pointer to the signal's sender instance.
+     */
+    const SignalObject* sender = nullptr;
+
+    /**
+     *  \var    probes
+     *  \brief  Number of index entries the emit's lookup compares.
+     */
+    std::uint32_t probes = 0;
+
+    /**
+     *  \var    connections
+     *  \brief  Number of connections the emit walks, including those of forwarded signals.
+     */
+    std::uint32_t connections = 0;
+
+    /**
+     *  \var    emits
+     *  \brief  Number of emits of the signal.
+     */
+    std::uint32_t emits = 0;
+
+    /**
+     *  \var    worst
+     *  \brief  Clock ticks of the longest emit including its slots.
+     */
+    std::uint32_t worst = 0;
+};
+
+/**
+ *  \class  SlotStatistics
+ *  \brief  The class accumulates the latencies of a connection's slot calls.
+ *  \note   Recording is lock-free, so slots may be measured from any context.
+ */
+class SlotStatistics
+{
+public:
+    /**
+     *  \fn         record(std::uint32_t duration)
+     *  \brief      Adds a slot call to the statistics.
+     *  \param[in]  duration passes the call's duration in clock ticks.
+     */
+    void record(std::uint32_t duration)
+    {
+        const std::size_t bucket = std::bit_width(duration);
+
+        _calls.fetch_add(1, std::memory_order_relaxed);
+        _histogram[bucket < ConnectionReport::Buckets ? bucket : ConnectionReport::Buckets - 1]
+                .fetch_add(1, std::memory_order_relaxed);
+
+        std::uint32_t total = _total.load(std::memory_order_relaxed);
+        while (!_total.compare_exchange_weak(total,
+                                             total > UINT32_MAX - duration ? UINT32_MAX : total + duration,
+                                             std::memory_order_relaxed));
+
+        std::uint32_t worst = _worst.load(std::memory_order_relaxed);
+        while (duration > worst && !_worst.compare_exchange_weak(worst, duration, std::memory_order_relaxed));
+    }
+
+    /**
+     *  \fn     reset(void)
+     *  \brief  Clears the statistics.
+     */
+    void reset(void)
+    {
+        _calls.store(0, std::memory_order_relaxed);
+        _total.store(0, std::memory_order_relaxed);
+        _worst.store(0, std::memory_order_relaxed);
+
+        for (std::atomic<std::uint32_t>& bucket : _histogram)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  \fn         report(ConnectionReport& report) const
+     *  \brief      Copies the statistics into a report.
+     *  \param[out] report returns the connection's report.
+     */
+    void report(ConnectionReport& report) const
+    {
+        report.calls = _calls.load(std::memory_order_relaxed);
+        report.total = _total.load(std::memory_order_relaxed);
+        report.worst = _worst.load(std::memory_order_relaxed);
+
+        for (std::size_t bucket = 0; bucket < ConnectionReport::Buckets; bucket++)
+        {
+            report.histogram[bucket] = _histogram[bucket].load(std::memory_order_relaxed);
+        }
+    }
+
+private:
+    /**
+     *  \var    _calls
+     *  \brief  Number of measured slot calls.
+     */
+    std::atomic<std::uint32_t> _calls = 0;
+
+    /**
+     *  \var    _total
+     *  \brief  Accumulated clock ticks of all slot calls.
+     */
+    std::atomic<std::uint32_t> _total = 0;
+
+    /**
+     *  \var    _worst
+     *  \brief  Clock ticks of the longest slot call.
+     */
+    std::atomic<std::uint32_t> _worst = 0;
+
+    /**
+     *  \var    _histogram
+     *  \brief  Number of slot calls per latency bucket.
+     */
+    std::atomic<std::uint32_t> _histogram[ConnectionReport::Buckets]{};
+};
+
+/**
+ *  \struct InstrumentationSource
+ *  \brief  The struct links an instrumented connection pool into the global registry.
+ */
+struct InstrumentationSource
+{
+    /**
+     *  \var    pool
+     *  \brief  Pointer to the instrumented pool.
+     */
+    const void* pool;
+
+    /**
+     *  \var    collect
+     *  \brief  Function offering the reports of all connections of the pool.
+     */
+    void (*collect)(const void* pool, std::span<ConnectionReport> reports, std::size_t& count);
+
+    /**
+     *  \var    signals
+     *  \brief  Function offering the reports of all signals of the pool.
+     */
+    void (*signals)(const void* pool, std::span<SignalReport> reports, std::size_t& count);
+
+    /**
+     *  \var    next
+     *  \brief  Pointer to the next registered source.
+     */
+    InstrumentationSource* next = nullptr;
+
+    /**
+     *  \var    attached
+     *  \brief  Boolean indicating if the source is registered.
+     */
+    bool attached = false;
+};
+
+/**
+ *  \class  Instrumentation
+ *  \brief  The class collects the statistics of all instrumented connection pools.
+ */
+class Instrumentation
+{
+public:
+    /**
+     *  \fn         dump(std::span<ConnectionReport> reports)
+     *  \brief      Reports the connections spending the most time in their slots.
+     *  \note       The function must be called from the context connecting and disconnecting.
+     *  \param[out] reports returns the hottest connections in descending order of total time.
+     *  \return     Number of reported connections.
+     */
+    static std::size_t dump(std::span<ConnectionReport> reports)
+    {
+        std::size_t count = 0;
+
+        for (InstrumentationSource* source = _sources; source; source = source->next)
+        {
+            source->collect(source->pool, reports, count);
+        }
+
+        return count;
+    }
+
+    /**
+     *  \fn         signals(std::span<SignalReport> reports)
+     *  \brief      Reports the signals with the longest emits, e.g. to derive their worst-case
+     *              execution time after driving all paths with the Wiring frozen.
+     *  \note       The function must be called from the context connecting and disconnecting.
+     *  \param[out] reports returns the slowest signals in descending order of their worst emit.
+     *  \return     Number of reported signals.
+     */
+    static std::size_t signals(std::span<SignalReport> reports)
+    {
+        std::size_t count = 0;
+
+        for (InstrumentationSource* source = _sources; source; source = source->next)
+        {
+            source->signals(source->pool, reports, count);
+        }
+
+        return count;
+    }
+
+    /**
+     *  \fn         attach(InstrumentationSource& source)
+     *  \brief      Registers a pool's source once.
+     *  \param[in]  source passes the pool's source.
+     */
+    static void attach(InstrumentationSource& source)
+    {
+        if (source.attached)
+        {
+            return;
+        }
+
+        source.next = _sources;
+        source.attached = true;
+        _sources = &source;
+    }
+
+    /**
+     *  \fn         offer(std::span<Report> reports, std::size_t& count, const Report& report)
+     *  \brief      Inserts a report into the sorted top list if it is hot enough.
+     *  \tparam     Report passes the type of the reports.
+     *  \param[in]  reports passes the top list.
+     *  \param[in]  count passes and returns the number of reports inside the top list.
+     *  \param[in]  report passes the report to insert.
+     */
+    template<class Report>
+    static void offer(std::span<Report> reports, std::size_t& count, const Report& report)
+    {
+        if (count == reports.size() && (count == 0 || weight(reports[count - 1]) >= weight(report)))
+        {
+            return;
+        }
+
+        std::size_t position = count < reports.size() ? count++ : count - 1;
+
+        for (; position > 0 && weight(reports[position - 1]) < weight(report); position--)
+        {
+            reports[position] = reports[position - 1];
+        }
+
+        reports[position] = report;
+    }
+
+private:
+    /**
+     *  \fn         weight(const ConnectionReport& report)
+     *  \brief      Ranks a connection by the total time spent in its slot.
+     *  \param[in]  report passes the connection's report.
+     *  \return     Sort key of the report.
+     */
+    static std::uint32_t weight(const ConnectionReport& report)
+    {
+        return report.total;
+    }
+
+    /**
+     *  \fn         weight(const SignalReport& report)
+     *  \brief      Ranks a signal by its longest emit.
+     *  \param[in]  report passes the signal's report.
+     *  \return     Sort key of the report.
+     */
+    static std::uint32_t weight(const SignalReport& report)
+    {
+        return report.worst;
+    }
+
+    /**
+     *  \var    _sources
+     *  \brief  Pointer to the first registered source.
+     */
+    inline static InstrumentationSource* _sources = nullptr;
+};
+
+#endif //INSTRUMENTATION_HPP
\ No newline at end of file
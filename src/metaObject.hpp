@@ -30,7 +30,7 @@ public:
      */
     void destroyed(void)
     {
-        fireAllSlots(this, &BaseObject::destroyed);
+        fireAllSlots(this, &MetaObject::destroyed);
     }
 };
 
@@ -0,0 +1,218 @@
+/**
+ *  \file   signalAwaiter.hpp
+ *  \brief  The file implements awaiting the next emit of a signal from a coroutine.
+ */
+
+#ifndef SIGNAL_AWAITER_HPP
+#define SIGNAL_AWAITER_HPP
+
+#include <coroutine>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "connectionHandle.hpp"
+#include "connectionLink.hpp"
+#include "signalKey.hpp"
+
+template<class... ParamPack>
+class ConnectionPool;
+
+/**
+ *  \struct SignalWaiterBase
+ *  \brief  The struct represents a coroutine linked into the waiter list of a signal.
+ */
+struct SignalWaiterBase
+{
+    /**
+     *  \var    handle
+     *  \brief  Handle of the suspended coroutine.
+     */
+    std::coroutine_handle<> handle{};
+
+    /**
+     *  \var    previous
+     *  \brief  Pointer to the previous waiter, the first waiter points to the last one.
+     */
+    SignalWaiterBase* previous = nullptr;
+
+    /**
+     *  \var    next
+     *  \brief  Pointer to the next waiter or nullptr for the last one.
+     */
+    SignalWaiterBase* next = nullptr;
+
+    /**
+     *  \var    entry
+     *  \brief  Position of the signal inside its pool's index or InvalidIndex if not linked.
+     */
+    ConnectionIndex entry = ConnectionHandle<>::InvalidIndex;
+};
+
+/**
+ *  \struct SignalWaiter
+ *  \brief  The struct adds the storage of the emitted arguments to a waiter.
+ *  \tparam ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+struct SignalWaiter : SignalWaiterBase
+{
+    /**
+     *  \typedef    Values
+     *  \brief      Type storing copies of the emitted arguments.
+     */
+    using Values = std::tuple<std::decay_t<ParamPack>...>;
+
+    /**
+     *  \var    values
+     *  \brief  Copies of the arguments the coroutine is resumed with.
+     */
+    std::optional<Values> values{};
+};
+
+/**
+ *  \class  SignalAwaiter
+ *  \brief  The class suspends a coroutine until the next emit of a signal.
+ *  \details The awaiter lives inside the coroutine frame and is linked into the signal's
+ *          waiter list without allocation. The coroutine is resumed by the emitting context
+ *          after all slots were called, so awaiting and emitting the signal must happen from
+ *          the context connecting and disconnecting.
+ *          The result is a boolean for signals without parameters, a std::optional of the
+ *          argument for signals with a single parameter and a std::optional of a tuple
+ *          otherwise. It is empty if the signal index of the signature is full.
+ *          A suspended awaiter is linked into the sender's connection list as well, so
+ *          destroying the sender unlinks it and the coroutine is never resumed.
+ *  \tparam ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+class SignalAwaiter : public SignalWaiter<ParamPack...>, private ConnectionLink
+{
+public:
+    /**
+     *  \fn         SignalAwaiter(ConnectionPool<ParamPack...>& pool, const SignalKey<ParamPack...>& key, ConnectionList* senderList)
+     *  \brief      The constructor initializes an awaiter of a sender's signal.
+     *  \param[in]  pool passes the pool of the signal's signature.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \param[in]  senderList passes the connection list of the sender instance or nullptr.
+     */
+    SignalAwaiter(ConnectionPool<ParamPack...>& pool,
+                  const SignalKey<ParamPack...>& key,
+                  ConnectionList* senderList
+    ) :
+            _pool(pool),
+            _key(key),
+            _senderList(senderList)
+    {}
+
+    SignalAwaiter(const SignalAwaiter&) = delete;
+    SignalAwaiter& operator=(const SignalAwaiter&) = delete;
+
+    /**
+     *  \fn     ~SignalAwaiter(void)
+     *  \brief  Removes the awaiter from the waiter list if its coroutine is destroyed while waiting.
+     */
+    ~SignalAwaiter(void)
+    {
+        _pool.cancel(this);
+        ConnectionLink::detach();
+    }
+
+    /**
+     *  \fn     await_ready(void) const
+     *  \brief  Requests suspension, a signal is never emitted ahead of its awaiter.
+     *  \return Always false.
+     */
+    bool await_ready(void) const noexcept
+    {
+        return false;
+    }
+
+    /**
+     *  \fn         await_suspend(std::coroutine_handle<> handle)
+     *  \brief      Links the coroutine into the signal's waiter list.
+     *  \param[in]  handle passes the handle of the suspending coroutine.
+     *  \return     Boolean indicating if the coroutine is suspended.
+     */
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        this->handle = handle;
+
+        if (!_pool.wait(_key, this))
+        {
+            return false;
+        }
+
+        if (_senderList)
+        {
+            ConnectionLink::attach(*_senderList, &unlink);
+        }
+
+        return true;
+    }
+
+    /**
+     *  \fn     await_resume(void)
+     *  \brief  Returns the emitted arguments.
+     *  \return Emitted arguments or an empty result if the signal could not be awaited.
+     */
+    auto await_resume(void)
+    {
+        ConnectionLink::detach();
+
+        if constexpr (sizeof...(ParamPack) == 0)
+        {
+            return this->values.has_value();
+        }
+        else if constexpr (sizeof...(ParamPack) == 1)
+        {
+            using Value = std::tuple_element_t<0, typename SignalWaiter<ParamPack...>::Values>;
+
+            return this->values ? std::optional<Value>(std::move(std::get<0>(*this->values))) : std::nullopt;
+        }
+        else
+        {
+            return std::move(this->values);
+        }
+    }
+
+private:
+    /**
+     *  \fn         unlink(ConnectionLink* link, LinkAction action)
+     *  \brief      Removes the awaiter from the waiter list when its sender is destroyed.
+     *  \param[in]  link passes the awaiter's link into the sender's connection list.
+     *  \param[in]  action passes what the sender's list applies, blocking is ignored.
+     */
+    static void unlink(ConnectionLink* link, LinkAction action)
+    {
+        if (action != LinkAction::Remove)
+        {
+            return;
+        }
+
+        SignalAwaiter* self = static_cast<SignalAwaiter*>(link);
+
+        self->_pool.cancel(self);
+        self->ConnectionLink::detach();
+    }
+
+    /**
+     *  \var    _pool
+     *  \brief  Pool of the signal's signature.
+     */
+    ConnectionPool<ParamPack...>& _pool;
+
+    /**
+     *  \var    _key
+     *  \brief  Key of the awaited sender's signal.
+     */
+    SignalKey<ParamPack...> _key;
+
+    /**
+     *  \var    _senderList
+     *  \brief  Pointer to the connection list of the sender instance or nullptr.
+     */
+    ConnectionList* _senderList;
+};
+
+#endif //SIGNAL_AWAITER_HPP
\ No newline at end of file
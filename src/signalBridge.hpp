@@ -0,0 +1,558 @@
+/**
+ *  \file   signalBridge.hpp
+ *  \brief  The file implements forwarding signals between cores or processes over shared memory.
+ */
+
+#ifndef SIGNAL_BRIDGE_HPP
+#define SIGNAL_BRIDGE_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "connection.hpp"
+#include "connectionHandle.hpp"
+#include "signalObject.hpp"
+
+#ifndef EMBEDDED_SIGNALS_BRIDGE_MESSAGE_SIZE
+/**
+ *  \def    EMBEDDED_SIGNALS_BRIDGE_MESSAGE_SIZE
+ *  \brief  Default number of bytes available to store the arguments of a bridged emit.
+ */
+#define EMBEDDED_SIGNALS_BRIDGE_MESSAGE_SIZE 64
+#endif
+
+#ifndef EMBEDDED_SIGNALS_BRIDGE_ROUTES
+/**
+ *  \def    EMBEDDED_SIGNALS_BRIDGE_ROUTES
+ *  \brief  Default number of routes a bridge is able to receive.
+ */
+#define EMBEDDED_SIGNALS_BRIDGE_ROUTES 16
+#endif
+
+/**
+ *  \concept    isBridgeable
+ *  \brief      Checks if all parameters of a signal can be copied bytewise to another address space.
+ *  \tparam     ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+concept isBridgeable = ((std::is_trivially_copyable_v<std::decay_t<ParamPack>> &&
+                         std::is_default_constructible_v<std::decay_t<ParamPack>> &&
+                         !std::is_pointer_v<std::decay_t<ParamPack>>) && ...);
+
+/**
+ *  \struct BridgeCodec
+ *  \brief  The struct serializes the arguments of a signal into a packed byte layout.
+ *  \details The layout is derived from the signature at compile time: the arguments are
+ *          stored back to back without padding, each one copied bytewise. Both sides of a
+ *          bridge must therefore agree on the signature and the byte order of each route.
+ *  \tparam ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+requires isBridgeable<ParamPack...>
+struct BridgeCodec
+{
+    /**
+     *  \typedef    Values
+     *  \brief      Type storing the decoded arguments.
+     */
+    using Values = std::tuple<std::decay_t<ParamPack>...>;
+
+    /**
+     *  \var    Size
+     *  \brief  Number of bytes of a serialized argument list.
+     */
+    static constexpr std::size_t Size = (std::size_t{0} + ... + sizeof(std::decay_t<ParamPack>));
+
+    /**
+     *  \fn         encode(unsigned char* data, const std::decay_t<ParamPack>&... args)
+     *  \brief      Serializes an argument list.
+     *  \param[out] data passes the storage of at least Size bytes.
+     *  \param[in]  args passes the arguments.
+     */
+    static void encode([[maybe_unused]] unsigned char* data, const std::decay_t<ParamPack>&... args)
+    {
+        (encodeArgument(data, args), ...);
+    }
+
+    /**
+     *  \fn         decode(const unsigned char* data)
+     *  \brief      Deserializes an argument list.
+     *  \param[in]  data passes the storage of Size bytes.
+     *  \return     Decoded arguments.
+     */
+    static Values decode(const unsigned char* data)
+    {
+        return decode(data, std::index_sequence_for<ParamPack...>{});
+    }
+
+private:
+    /**
+     *  \var    Offsets
+     *  \brief  Position of each argument inside the serialized argument list.
+     */
+    static constexpr std::array<std::size_t, sizeof...(ParamPack)> Offsets = []()
+    {
+        std::array<std::size_t, sizeof...(ParamPack)> offsets{};
+        std::size_t offset = 0;
+        std::size_t index = 0;
+
+        ((offsets[index++] = offset, offset += sizeof(std::decay_t<ParamPack>)), ...);
+
+        return offsets;
+    }();
+
+    /**
+     *  \fn         encodeArgument(unsigned char*& data, const Value& value)
+     *  \brief      Appends a single argument.
+     *  \tparam     Value passes the argument's type.
+     *  \param[in]  data passes and returns the write position.
+     *  \param[in]  value passes the argument.
+     */
+    template<class Value>
+    static void encodeArgument(unsigned char*& data, const Value& value)
+    {
+        std::memcpy(data, &value, sizeof(Value));
+        data += sizeof(Value);
+    }
+
+    /**
+     *  \fn         decode(const unsigned char* data, std::index_sequence<Indices...>)
+     *  \brief      Deserializes each argument from its offset.
+     *  \tparam     Indices passes the arguments' positions.
+     *  \param[in]  data passes the storage of Size bytes.
+     *  \return     Decoded arguments.
+     */
+    template<std::size_t... Indices>
+    static Values decode([[maybe_unused]] const unsigned char* data, std::index_sequence<Indices...>)
+    {
+        Values values{};
+
+        (std::memcpy(&std::get<Indices>(values), data + Offsets[Indices], sizeof(std::tuple_element_t<Indices, Values>)), ...);
+
+        return values;
+    }
+};
+
+/**
+ *  \class  BridgeChannel
+ *  \brief  The class implements a lock-free ring of serialized emits inside shared memory.
+ *  \details The channel holds no pointers, so it may be mapped at different addresses by
+ *          two processes or placed into memory shared by two cores. Any number of contexts
+ *          on the sending side may post, while a single context on the receiving side polls.
+ *          The channel must be constructed once before either side uses it, e.g. by placement
+ *          new into the shared region from the side booting first.
+ *  \note   The atomics must be lock-free for the channel to work across address spaces, and
+ *          the shared region must be coherent or uncached between the cores.
+ *  \tparam Capacity passes the number of messages, which must be a power of two.
+ *  \tparam MessageSize passes the number of bytes available per message.
+ */
+template<std::size_t Capacity, std::size_t MessageSize = EMBEDDED_SIGNALS_BRIDGE_MESSAGE_SIZE>
+class BridgeChannel
+{
+    static_assert(std::has_single_bit(Capacity) && Capacity <= UINT16_MAX, "The channel capacity must be a power of two.");
+    static_assert(MessageSize <= UINT16_MAX, "The message size is too large.");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Channel positions must be lock-free.");
+
+public:
+    /**
+     *  \var    PayloadSize
+     *  \brief  Number of bytes available per message.
+     */
+    static constexpr std::size_t PayloadSize = MessageSize;
+
+    /**
+     *  \fn     BridgeChannel(void)
+     *  \brief  The constructor initializes an empty channel.
+     */
+    BridgeChannel(void)
+    {
+        for (std::uint32_t position = 0; position < Capacity; position++)
+        {
+            _messages[position].sequence.store(position, std::memory_order_relaxed);
+        }
+    }
+
+    BridgeChannel(const BridgeChannel&) = delete;
+    BridgeChannel& operator=(const BridgeChannel&) = delete;
+
+    /**
+     *  \fn         post(std::uint16_t route, std::uint16_t size, Encode&& encode)
+     *  \brief      Writes a message into the channel.
+     *  \tparam     Encode passes the typename of the callable serializing the payload.
+     *  \param[in]  route passes the route of the message.
+     *  \param[in]  size passes the payload's size in bytes.
+     *  \param[in]  encode passes the callable receiving the payload's storage.
+     *  \return     Boolean indicating if the message was posted, false if the channel is full.
+     */
+    template<class Encode>
+    bool post(std::uint16_t route, std::uint16_t size, Encode&& encode)
+    {
+        std::uint32_t position = _enqueue.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            Message& message = _messages[position & (Capacity - 1)];
+            const std::uint32_t sequence = message.sequence.load(std::memory_order_acquire);
+            const std::int32_t difference = static_cast<std::int32_t>(sequence - position);
+
+            if (difference == 0)
+            {
+                if (_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    message.route = route;
+                    message.size = size;
+                    encode(message.payload);
+                    message.sequence.store(position + 1, std::memory_order_release);
+
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+
+                return false;
+            }
+            else
+            {
+                position = _enqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     *  \fn         poll(Decode&& decode)
+     *  \brief      Takes the oldest message from the channel.
+     *  \note       The function must only be called from a single context at a time.
+     *  \tparam     Decode passes the typename of the callable handling the message.
+     *  \param[in]  decode passes the callable receiving route, payload and size of the message.
+     *  \return     Boolean indicating if a message was taken.
+     */
+    template<class Decode>
+    bool poll(Decode&& decode)
+    {
+        const std::uint32_t position = _dequeue.load(std::memory_order_relaxed);
+        Message& message = _messages[position & (Capacity - 1)];
+
+        if (message.sequence.load(std::memory_order_acquire) != position + 1)
+        {
+            return false;
+        }
+
+        decode(message.route, static_cast<const unsigned char*>(message.payload), message.size);
+
+        _dequeue.store(position + 1, std::memory_order_relaxed);
+        message.sequence.store(position + Capacity, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     *  \fn     dropped(void) const
+     *  \brief  Returns the number of messages lost because the channel was full.
+     *  \return Number of dropped messages.
+     */
+    std::uint32_t dropped(void) const
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     *  \struct Message
+     *  \brief  The struct stores a serialized emit.
+     */
+    struct Message
+    {
+        /**
+         *  \var    sequence
+         *  \brief  Sequence number synchronizing the senders and the receiver.
+         */
+        std::atomic<std::uint32_t> sequence;
+
+        /**
+         *  \var    route
+         *  \brief  Route identifying the signal on the receiving side.
+         */
+        std::uint16_t route;
+
+        /**
+         *  \var    size
+         *  \brief  Number of payload bytes.
+         */
+        std::uint16_t size;
+
+        /**
+         *  \var    payload
+         *  \brief  Serialized arguments.
+         */
+        unsigned char payload[MessageSize];
+    };
+
+    /**
+     *  \var    _enqueue
+     *  \brief  Next position claimed by a sender.
+     */
+    std::atomic<std::uint32_t> _enqueue = 0;
+
+    /**
+     *  \var    _dequeue
+     *  \brief  Next position taken by the receiver.
+     */
+    std::atomic<std::uint32_t> _dequeue = 0;
+
+    /**
+     *  \var    _dropped
+     *  \brief  Number of messages lost because the channel was full.
+     */
+    std::atomic<std::uint32_t> _dropped = 0;
+
+    /**
+     *  \var    _messages
+     *  \brief  Ring of messages.
+     */
+    Message _messages[Capacity];
+};
+
+/**
+ *  \class  SignalBridge
+ *  \brief  The class forwards signals to and re-emits signals from another core or process.
+ *  \details Each side owns a bridge on its own memory, connected to a channel per direction.
+ *          transmit() connects a local signal to the bridge, which serializes every emit into
+ *          the outgoing channel and rings the doorbell, e.g. by raising an inter-core interrupt
+ *          or writing to an eventfd. receive() binds a route to a local proxy's signal, which
+ *          poll() emits for every incoming message, typically called from the doorbell handler.
+ *          No allocation takes place, the arguments are written directly into the channel.
+ *  \tparam Channel passes the typename of the channels.
+ *  \tparam Routes passes the number of routes the bridge is able to receive.
+ */
+template<class Channel, std::size_t Routes = EMBEDDED_SIGNALS_BRIDGE_ROUTES>
+class SignalBridge : public SignalObject
+{
+public:
+    /**
+     *  \fn         SignalBridge(Channel* transmit, Channel* receive)
+     *  \brief      The constructor initializes a bridge.
+     *  \param[in]  transmit passes a pointer to the outgoing channel or nullptr.
+     *  \param[in]  receive passes a pointer to the incoming channel or nullptr.
+     */
+    SignalBridge(Channel* transmit, Channel* receive) :
+            _transmit(transmit),
+            _receive(receive)
+    {}
+
+    /**
+     *  \fn         setDoorbell(void (*doorbell)(void* context), void* context)
+     *  \brief      Assigns a function notifying the other side after a message was posted.
+     *  \note       The function is called from the emitting context.
+     *  \param[in]  doorbell passes the function to call or nullptr.
+     *  \param[in]  context passes the argument of the function.
+     */
+    void setDoorbell(void (*doorbell)(void* context), void* context)
+    {
+        _doorbell = doorbell;
+        _context = context;
+    }
+
+    /**
+     *  \fn         transmit()
+     *  \brief      Forwards every emit of a local signal to the other side.
+     *  \note       Emits are dropped while the outgoing channel is full.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  route passes the route of the signal on the other side.
+     *  \return     Handle of the connection or an invalid handle if it failed.
+     */
+    template<class Sender, class SenderBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isBridgeable<ParamPack...>
+    ConnectionHandle<ParamPack...> transmit(Sender* sender,
+                                            void(SenderBase::*signal)(ParamPack...),
+                                            std::uint16_t route
+    )
+    {
+        static_assert(BridgeCodec<ParamPack...>::Size <= Channel::PayloadSize, "The arguments exceed the channel's message size.");
+
+        if (!_transmit)
+        {
+            return ConnectionHandle<ParamPack...>();
+        }
+
+        return SignalObject::connect(sender, signal, this, [this, route](const std::decay_t<ParamPack>&... args)
+        {
+            constexpr std::uint16_t size = BridgeCodec<ParamPack...>::Size;
+
+            if (_transmit->post(route, size, [&](unsigned char* data) { BridgeCodec<ParamPack...>::encode(data, args...); }) &&
+                _doorbell)
+            {
+                _doorbell(_context);
+            }
+        });
+    }
+
+    /**
+     *  \fn         receive()
+     *  \brief      Emits a local proxy's signal for every message of a route.
+     *  \note       Messages whose size does not match the signature are dropped.
+     *  \tparam     Proxy passes the proxy's typename.
+     *  \tparam     ProxyBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  route passes the route of the messages, which must be less than Routes.
+     *  \param[in]  proxy passes a pointer to the proxy instance emitting the signal.
+     *  \param[in]  signal passes a method pointer to the proxy's signal.
+     *  \return     Boolean indicating if the route was bound.
+     */
+    template<class Proxy, class ProxyBase, class... ParamPack>
+    requires isDerived<ProxyBase, Proxy> && isDerived<SignalObject, Proxy> && isBridgeable<ParamPack...>
+    bool receive(std::uint16_t route, Proxy* proxy, void(ProxyBase::*signal)(ParamPack...))
+    {
+        using Signal = void(ProxyBase::*)(ParamPack...);
+
+        static_assert(sizeof(Signal) <= sizeof(Route::signal), "Method pointers of the proxy exceed the route's storage.");
+
+        if (route >= Routes || !proxy)
+        {
+            return false;
+        }
+
+        Route& entry = _routes[route];
+
+        entry.proxy = proxy;
+        std::memcpy(entry.signal, &signal, sizeof(Signal));
+        entry.size = BridgeCodec<ParamPack...>::Size;
+        entry.deliver = [](const Route& route, const unsigned char* data)
+        {
+            Signal signal;
+            typename BridgeCodec<ParamPack...>::Values values = BridgeCodec<ParamPack...>::decode(data);
+
+            std::memcpy(&signal, route.signal, sizeof(Signal));
+            std::apply([&](auto&... args) { SignalObject::fireAllSlots(static_cast<Proxy*>(route.proxy), signal, std::move(args)...); },
+                       values);
+        };
+
+        return true;
+    }
+
+    /**
+     *  \fn         poll(std::size_t maximum)
+     *  \brief      Emits the proxy signals of incoming messages in the order they were posted.
+     *  \note       The function must only be called from a single context at a time.
+     *  \param[in]  maximum passes the maximum number of messages to take.
+     *  \return     Number of taken messages.
+     */
+    std::size_t poll(std::size_t maximum = SIZE_MAX)
+    {
+        std::size_t count = 0;
+
+        if (!_receive)
+        {
+            return count;
+        }
+
+        while (count < maximum && _receive->poll([this](std::uint16_t route, const unsigned char* data, std::uint16_t size)
+        {
+            if (route < Routes && _routes[route].deliver && _routes[route].size == size)
+            {
+                _routes[route].deliver(_routes[route], data);
+            }
+            else
+            {
+                _rejected++;
+            }
+        }))
+        {
+            count++;
+        }
+
+        return count;
+    }
+
+    /**
+     *  \fn     rejected(void) const
+     *  \brief  Returns the number of incoming messages without a matching route.
+     *  \return Number of rejected messages.
+     */
+    std::size_t rejected(void) const
+    {
+        return _rejected;
+    }
+
+private:
+    /**
+     *  \struct Route
+     *  \brief  The struct binds a route to the signal of a local proxy.
+     */
+    struct Route
+    {
+        /**
+         *  \var    proxy
+         *  \brief  Pointer to the proxy instance.
+         */
+        SignalObject* proxy = nullptr;
+
+        /**
+         *  \var    signal
+         *  \brief  Object representation of the method pointer to the proxy's signal.
+         */
+        alignas(void(SignalObject::*)(void)) unsigned char signal[sizeof(void(SignalObject::*)(void))]{};
+
+        /**
+         *  \var    size
+         *  \brief  Number of payload bytes of the signature.
+         */
+        std::size_t size = 0;
+
+        /**
+         *  \var    deliver
+         *  \brief  Function decoding a payload and emitting the proxy's signal.
+         */
+        void (*deliver)(const Route& route, const unsigned char* data) = nullptr;
+    };
+
+    /**
+     *  \var    _transmit
+     *  \brief  Pointer to the outgoing channel or nullptr.
+     */
+    Channel* _transmit;
+
+    /**
+     *  \var    _receive
+     *  \brief  Pointer to the incoming channel or nullptr.
+     */
+    Channel* _receive;
+
+    /**
+     *  \var    _doorbell
+     *  \brief  Function notifying the other side after a message was posted.
+     */
+    void (*_doorbell)(void* context) = nullptr;
+
+    /**
+     *  \var    _context
+     *  \brief  Argument of the doorbell function.
+     */
+    void* _context = nullptr;
+
+    /**
+     *  \var    _routes
+     *  \brief  Proxy signals of the incoming routes.
+     */
+    Route _routes[Routes]{};
+
+    /**
+     *  \var    _rejected
+     *  \brief  Number of incoming messages without a matching route.
+     */
+    std::size_t _rejected = 0;
+};
+
+#endif //SIGNAL_BRIDGE_HPP
\ No newline at end of file
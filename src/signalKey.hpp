@@ -0,0 +1,258 @@
+/**
+ *  \file   signalKey.hpp
+ *  \brief  The file implements the key identifying a sender's signal.
+ */
+
+#ifndef SIGNAL_KEY_HPP
+#define SIGNAL_KEY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+class SignalObject;
+
+/**
+ *  \struct SignalKey
+ *  \brief  The struct identifies a signal of a specific sender instance.
+ *  \tparam ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+struct SignalKey
+{
+    /**
+     *  \var    sender
+     *  \brief  Pointer to the sender instance.
+     */
+    const SignalObject* sender;
+
+    /**
+     *  \var    signal
+     *  \brief  Method pointer to the sender's signal.
+     */
+    void(SignalObject::*signal)(ParamPack...);
+
+    /**
+     *  \fn         operator==(const SignalKey& other) const
+     *  \brief      Compares two keys for equality.
+     *  \param[in]  other passes the key to compare with.
+     *  \return     Boolean indicating if both keys identify the same signal.
+     */
+    bool operator==(const SignalKey& other) const
+    {
+        return sender == other.sender && signal == other.signal;
+    }
+};
+
+/**
+ *  \struct SignalId
+ *  \brief  The struct identifies a signal of a specific sender instance independent of its signature.
+ *  \note   The signal's method pointer is kept as its object representation, so keys of all
+ *          signatures are stored and compared by the same code.
+ */
+struct SignalId
+{
+    /**
+     *  \var    sender
+     *  \brief  Pointer to the sender instance.
+     */
+    const SignalObject* sender = nullptr;
+
+    /**
+     *  \var    signal
+     *  \brief  Object representation of the method pointer to the sender's signal.
+     */
+    unsigned char signal[sizeof(void(SignalObject::*)(void))]{};
+
+    /**
+     *  \fn         SignalId(void)
+     *  \brief      The constructor initializes an empty identifier.
+     */
+    SignalId(void) = default;
+
+    /**
+     *  \fn         SignalId(const SignalKey<ParamPack...>& key)
+     *  \brief      The constructor erases the signature of a key.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  key passes the key of the sender's signal.
+     */
+    template<class... ParamPack>
+    SignalId(const SignalKey<ParamPack...>& key) :
+            sender(key.sender)
+    {
+        static_assert(sizeof(key.signal) == sizeof(signal), "Method pointers of SignalObject differ in size.");
+
+        std::memcpy(signal, &key.signal, sizeof(signal));
+    }
+
+    /**
+     *  \fn         operator==(const SignalId& other) const
+     *  \brief      Compares two identifiers for equality.
+     *  \param[in]  other passes the identifier to compare with.
+     *  \return     Boolean indicating if both identifiers name the same signal.
+     */
+    bool operator==(const SignalId& other) const
+    {
+        return sender == other.sender && std::memcmp(signal, other.signal, sizeof(signal)) == 0;
+    }
+};
+
+/**
+ *  \class  SignalSummary
+ *  \brief  The class records which signals of a sender have connections.
+ *  \details The signals are hashed into buckets of saturating counters packed into a single
+ *          word, each counting the connected signals of its bucket. A zero counter proves
+ *          that a signal has no connections with one load, a non-zero counter requires a
+ *          lookup. Saturated counters are never decremented again.
+ *  \note   The counters are modified by the context connecting and disconnecting only and
+ *          may be read from any context.
+ */
+class SignalSummary
+{
+public:
+    /**
+     *  \fn         mayContain(const SignalKey<ParamPack...>& key) const
+     *  \brief      Checks if a signal may have connections.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \return     Boolean indicating that the signal has none if false.
+     */
+    template<class... ParamPack>
+    bool mayContain(const SignalKey<ParamPack...>& key) const
+    {
+        return (_counts.load(std::memory_order_relaxed) >> shiftOf(&key.signal)) & Saturated;
+    }
+
+    /**
+     *  \fn         add(const SignalId& id)
+     *  \brief      Records that a signal got its first connection.
+     *  \param[in]  id passes the identifier of the sender's signal.
+     */
+    void add(const SignalId& id)
+    {
+        const unsigned shift = shiftOf(id.signal);
+        const std::uint32_t counts = _counts.load(std::memory_order_relaxed);
+
+        if (((counts >> shift) & Saturated) != Saturated)
+        {
+            _counts.store(counts + (std::uint32_t{1} << shift), std::memory_order_release);
+        }
+    }
+
+    /**
+     *  \fn         remove(const SignalId& id)
+     *  \brief      Records that a signal lost its last connection.
+     *  \param[in]  id passes the identifier of the sender's signal.
+     */
+    void remove(const SignalId& id)
+    {
+        const unsigned shift = shiftOf(id.signal);
+        const std::uint32_t counts = _counts.load(std::memory_order_relaxed);
+        const std::uint32_t count = (counts >> shift) & Saturated;
+
+        if (count != 0 && count != Saturated)
+        {
+            _counts.store(counts - (std::uint32_t{1} << shift), std::memory_order_relaxed);
+        }
+    }
+
+private:
+    /**
+     *  \var    Width
+     *  \brief  Number of bits of a bucket's counter.
+     */
+    static constexpr unsigned Width = 4;
+
+    /**
+     *  \var    Saturated
+     *  \brief  Value of a bucket's counter that is never decremented again.
+     */
+    static constexpr std::uint32_t Saturated = (1u << Width) - 1;
+
+    /**
+     *  \fn         shiftOf(const void* signal)
+     *  \brief      Computes the position of a signal's bucket inside the counters.
+     *  \note       Only the method pointer is hashed, the counters belong to the sender.
+     *  \param[in]  signal passes the object representation of the signal's method pointer.
+     *  \return     Bit position of the bucket's counter.
+     */
+    static unsigned shiftOf(const void* signal)
+    {
+        static_assert(sizeof(std::uintptr_t) <= sizeof(SignalId::signal), "Method pointers are smaller than a word.");
+
+        std::uintptr_t word;
+        std::memcpy(&word, signal, sizeof(word));
+
+        const std::uint32_t folded = static_cast<std::uint32_t>(word) ^
+                                     static_cast<std::uint32_t>(static_cast<std::uint64_t>(word) >> 32);
+
+        return static_cast<unsigned>((folded * 0x9E3779B1u) >> 29) * Width;
+    }
+
+    /**
+     *  \var    _counts
+     *  \brief  Counters of all buckets.
+     */
+    std::atomic<std::uint32_t> _counts = 0;
+};
+
+/**
+ *  \struct std::hash<SignalId>
+ *  \brief  The struct computes the hash value of a signal identifier.
+ */
+template<>
+struct std::hash<SignalId>
+{
+    /**
+     *  \fn         operator()(const SignalId& id) const
+     *  \brief      Hashes the sender's address and the signal's method pointer.
+     *  \param[in]  id passes the identifier to hash.
+     *  \return     Hash value of the identifier.
+     */
+    std::size_t operator()(const SignalId& id) const
+    {
+        std::size_t hash = std::hash<const void*>{}(id.sender);
+
+        for (unsigned char byte : id.signal)
+        {
+            hash = hash * 31 + byte;
+        }
+
+        return hash;
+    }
+};
+
+/**
+ *  \struct std::hash<SignalKey<ParamPack...>>
+ *  \brief  The struct computes the hash value of a signal key.
+ *  \tparam ParamPack passes the signal's parameter pack.
+ */
+template<class... ParamPack>
+struct std::hash<SignalKey<ParamPack...>>
+{
+    /**
+     *  \fn         operator()(const SignalKey<ParamPack...>& key) const
+     *  \brief      Hashes the sender's address and the signal's method pointer.
+     *  \param[in]  key passes the key to hash.
+     *  \return     Hash value of the key.
+     */
+    std::size_t operator()(const SignalKey<ParamPack...>& key) const
+    {
+        unsigned char bytes[sizeof(key.signal)];
+        std::memcpy(bytes, &key.signal, sizeof(key.signal));
+
+        std::size_t hash = std::hash<const void*>{}(key.sender);
+
+        for (unsigned char byte : bytes)
+        {
+            hash = hash * 31 + byte;
+        }
+
+        return hash;
+    }
+};
+
+#endif //SIGNAL_KEY_HPP
\ No newline at end of file
@@ -6,9 +6,25 @@
 #ifndef SIGNAL_OBJECT_HPP
 #define SIGNAL_OBJECT_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
+#include "batch.hpp"
 #include "connection.hpp"
+#include "connectionGroup.hpp"
+#include "connectionHandle.hpp"
+#include "connectionLink.hpp"
+#include "connectionPool.hpp"
+#include "delegate.hpp"
+#include "eventQueue.hpp"
+#include "footprint.hpp"
+#include "signalAwaiter.hpp"
+#include "signalKey.hpp"
+#include "signalTrace.hpp"
+#include "staticConnection.hpp"
+#include "wiring.hpp"
 
 /**
  *  \class  SignalObject
@@ -17,9 +33,50 @@
 class SignalObject
 {
 public:
+    /**
+     *  \fn     SignalObject(void)
+     *  \brief  The constructor initializes an object without connections.
+     */
+    SignalObject(void) = default;
+
+    /**
+     *  \fn     SignalObject(const SignalObject&)
+     *  \brief  The copy constructor initializes an object without connections.
+     *  \note   Connections and the event queue belong to an instance and are not copied.
+     */
+    SignalObject(const SignalObject&) :
+            SignalObject()
+    {}
+
+    /**
+     *  \fn     operator=(const SignalObject&)
+     *  \brief  The assignment keeps the object's own connections.
+     *  \return Reference to the object.
+     */
+    SignalObject& operator=(const SignalObject&)
+    {
+        return *this;
+    }
+
+    /**
+     *  \fn     ~SignalObject(void)
+     *  \brief  Destroys the object and removes all connections it is sender or receiver of.
+     */
+    ~SignalObject(void)
+    {
+        removeAll();
+
+        if (_traced.load(std::memory_order_relaxed))
+        {
+            SignalTrace::forget(this);
+        }
+    }
+
     /**
      *  \fn         connect()
      *  \brief      Connects a sender's signal to a receiver's slot.
+     *  \note       Connecting and disconnecting must happen from a single context at a time,
+     *              while signals may be emitted concurrently from any context.
      *  \tparam     Sender passes the sender's typename.
      *  \tparam     Receiver passes the receiver's typename.
      *  \tparam     SenderBase passes the signal's implementaion class.
@@ -29,26 +86,242 @@ public:
      *  \param[in]  receiver passes a pointer to the receiver instance.
      *  \param[in]  signal passes a method pointer to the sender's signal.
      *  \param[in]  slot passes a method pointer to the receiver's slot.
+     *  \param[in]  type passes whether the slot is called directly or via the receiver's event queue.
+     *  \param[in]  priority passes the slot's priority, slots of higher priority are called first.
+     *  \param[in]  expiry passes when the connection removes itself, e.g. ConnectionExpiry::singleShot().
+     *  \param[in]  policy passes the policy filtering the emits, e.g. a Throttle, or nullptr.
+     *  \return     Handle of the connection or an invalid handle if it could not be stored.
      */
     template<class Sender, class Receiver, class SenderBase, class ReceiverBase, class... ParamPack>
     requires isDerived<SenderBase, Sender> && isDerived<ReceiverBase, Receiver>
-    static void connect(Sender* sender,
-                        Receiver* receiver,
-                        void(SenderBase::*signal)(ParamPack...),
-                        void(ReceiverBase::*slot)(ParamPack...)
+    static ConnectionHandle<ParamPack...> connect(Sender* sender,
+                                                  Receiver* receiver,
+                                                  void(SenderBase::*signal)(ParamPack...),
+                                                  void(ReceiverBase::*slot)(ParamPack...),
+                                                  ConnectionType type = ConnectionType::Direct,
+                                                  ConnectionPriority priority = 0,
+                                                  ConnectionExpiry expiry = {},
+                                                  DeliveryPolicy<ParamPack...>* policy = nullptr
     )
     {
-        Connection<ParamPack...>* connection = new Connection(sender,
-                                                              receiver,
-                                                              signal,
-                                                              slot);
-        
-        _connections<ParamPack...>.push_back(connection);
+        return insert(sender,
+                      signal,
+                      static_cast<SignalObject*>(receiver),
+                      Delegate<ParamPack...>(receiver, slot),
+                      type,
+                      priority,
+                      expiry,
+                      policy);
+    }
+
+    /**
+     *  \fn         connect()
+     *  \brief      Connects a sender's signal to a receiver's batch slot.
+     *  \note       The slot receives a whole batch per fireBatch() and a batch of one per emit.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     Receiver passes the receiver's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ReceiveBase passes the slot's implementation class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  receiver passes a pointer to the receiver instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  slot passes a method pointer to the receiver's batch slot.
+     *  \param[in]  type passes whether the slot is called directly or via the receiver's event queue.
+     *  \param[in]  priority passes the slot's priority, slots of higher priority are called first.
+     *  \param[in]  expiry passes when the connection removes itself, e.g. ConnectionExpiry::singleShot().
+     *  \param[in]  policy passes the policy filtering the emits, e.g. a Throttle, or nullptr.
+     *  \return     Handle of the connection or an invalid handle if it could not be stored.
+     */
+    template<class Sender, class Receiver, class SenderBase, class ReceiverBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isDerived<ReceiverBase, Receiver>
+    static ConnectionHandle<ParamPack...> connect(Sender* sender,
+                                                  Receiver* receiver,
+                                                  void(SenderBase::*signal)(ParamPack...),
+                                                  void(ReceiverBase::*slot)(Batch<ParamPack...>),
+                                                  ConnectionType type = ConnectionType::Direct,
+                                                  ConnectionPriority priority = 0,
+                                                  ConnectionExpiry expiry = {},
+                                                  DeliveryPolicy<ParamPack...>* policy = nullptr
+    )
+    {
+        return insert(sender,
+                      signal,
+                      static_cast<SignalObject*>(receiver),
+                      Delegate<ParamPack...>(receiver, slot),
+                      type,
+                      priority,
+                      expiry,
+                      policy);
+    }
+
+    /**
+     *  \fn         connect()
+     *  \brief      Connects a sender's signal to a receiver's slot bound at compile time.
+     *  \details    Usage: SignalObject::connect<&Filter::onSample>(&sensor, &filter, &Sensor::sampled);
+     *              The connection only stores the receiver pointer, so it fits a delegate of
+     *              EMBEDDED_SIGNALS_DELEGATE_SIZE sizeof(void*), and the slot is called directly
+     *              by the invoker instead of through a method pointer.
+     *  \tparam     Slot passes a method pointer to the receiver's slot or batch slot.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     Receiver passes the receiver's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  receiver passes a pointer to the receiver instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  type passes whether the slot is called directly or via the receiver's event queue.
+     *  \param[in]  priority passes the slot's priority, slots of higher priority are called first.
+     *  \param[in]  expiry passes when the connection removes itself, e.g. ConnectionExpiry::singleShot().
+     *  \param[in]  policy passes the policy filtering the emits, e.g. a Throttle, or nullptr.
+     *  \return     Handle of the connection or an invalid handle if it could not be stored.
+     */
+    template<auto Slot, class Sender, class Receiver, class SenderBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isDerived<SignalObject, Receiver> &&
+             std::is_member_function_pointer_v<decltype(Slot)>
+    static ConnectionHandle<ParamPack...> connect(Sender* sender,
+                                                  Receiver* receiver,
+                                                  void(SenderBase::*signal)(ParamPack...),
+                                                  ConnectionType type = ConnectionType::Direct,
+                                                  ConnectionPriority priority = 0,
+                                                  ConnectionExpiry expiry = {},
+                                                  DeliveryPolicy<ParamPack...>* policy = nullptr
+    )
+    {
+        return insert(sender,
+                      signal,
+                      static_cast<SignalObject*>(receiver),
+                      Delegate<ParamPack...>::template bind<Slot>(receiver),
+                      type,
+                      priority,
+                      expiry,
+                      policy);
+    }
+
+    /**
+     *  \fn         connect()
+     *  \brief      Connects a sender's signal to a callable bound to a receiver.
+     *  \note       The receiver provides the event queue of queued connections.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     Receiver passes the receiver's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     Function passes the callable's typename.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  receiver passes a pointer to the receiver instance.
+     *  \param[in]  function passes the lambda, free function or functor to connect as slot.
+     *  \param[in]  type passes whether the slot is called directly or via the receiver's event queue.
+     *  \param[in]  priority passes the slot's priority, slots of higher priority are called first.
+     *  \param[in]  expiry passes when the connection removes itself, e.g. ConnectionExpiry::singleShot().
+     *  \param[in]  policy passes the policy filtering the emits, e.g. a Throttle, or nullptr.
+     *  \return     Handle of the connection or an invalid handle if it could not be stored.
+     */
+    template<class Sender, class Receiver, class SenderBase, class Function, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isDerived<SignalObject, Receiver> && isCallable<Function, ParamPack...>
+    static ConnectionHandle<ParamPack...> connect(Sender* sender,
+                                                  void(SenderBase::*signal)(ParamPack...),
+                                                  Receiver* receiver,
+                                                  Function&& function,
+                                                  ConnectionType type = ConnectionType::Direct,
+                                                  ConnectionPriority priority = 0,
+                                                  ConnectionExpiry expiry = {},
+                                                  DeliveryPolicy<ParamPack...>* policy = nullptr
+    )
+    {
+        return insert(sender,
+                      signal,
+                      static_cast<SignalObject*>(receiver),
+                      Delegate<ParamPack...>(std::forward<Function>(function)),
+                      type,
+                      priority,
+                      expiry,
+                      policy);
+    }
+
+    /**
+     *  \fn         connect()
+     *  \brief      Connects a sender's signal to a callable.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     Function passes the callable's typename.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  function passes the lambda, free function or functor to connect as slot.
+     *  \param[in]  priority passes the slot's priority, slots of higher priority are called first.
+     *  \param[in]  expiry passes when the connection removes itself, e.g. ConnectionExpiry::singleShot().
+     *  \param[in]  policy passes the policy filtering the emits, e.g. a Throttle, or nullptr.
+     *  \return     Handle of the connection or an invalid handle if it could not be stored.
+     */
+    template<class Sender, class SenderBase, class Function, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isCallable<Function, ParamPack...>
+    static ConnectionHandle<ParamPack...> connect(Sender* sender,
+                                                  void(SenderBase::*signal)(ParamPack...),
+                                                  Function&& function,
+                                                  ConnectionPriority priority = 0,
+                                                  ConnectionExpiry expiry = {},
+                                                  DeliveryPolicy<ParamPack...>* policy = nullptr
+    )
+    {
+        return insert(sender,
+                      signal,
+                      nullptr,
+                      Delegate<ParamPack...>(std::forward<Function>(function)),
+                      ConnectionType::Direct,
+                      priority,
+                      expiry,
+                      policy);
+    }
+
+    /**
+     *  \fn         forward()
+     *  \brief      Forwards a sender's signal to the slots of another object's signal.
+     *  \details    The forwarded signal's index entry is resolved once, so an emit dispatches to
+     *              the slots of the whole chain in a single pass, instead of a slot emitting the
+     *              next signal and looking it up again. Awaiting coroutines of forwarded signals
+     *              are resumed as well.
+     *  \note       The forwarded signal method itself is not called, neither are its compile
+     *              time connections. Chains of more than EMBEDDED_SIGNALS_FORWARD_DEPTH
+     *              forwarding connections and cycles are rejected.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     Target passes the forwarding object's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     TargetBase passes the forwarded signal's implementation class.
+     *  \tparam     ParamPack passes the signals' parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  target passes a pointer to the instance of the forwarded signal.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  forwarded passes a method pointer to the target's signal.
+     *  \param[in]  priority passes the forward's priority among the slots of the sender's signal.
+     *  \param[in]  expiry passes when the connection removes itself, e.g. ConnectionExpiry::singleShot().
+     *  \return     Handle of the connection or an invalid handle if it could not be stored.
+     */
+    template<class Sender, class Target, class SenderBase, class TargetBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isDerived<TargetBase, Target>
+    static ConnectionHandle<ParamPack...> forward(Sender* sender,
+                                                  Target* target,
+                                                  void(SenderBase::*signal)(ParamPack...),
+                                                  void(TargetBase::*forwarded)(ParamPack...),
+                                                  ConnectionPriority priority = 0,
+                                                  ConnectionExpiry expiry = {}
+    )
+    {
+        return _connections<ParamPack...>.insertForward(makeKey(sender, signal),
+                                                        makeKey(target, forwarded),
+                                                        priority,
+                                                        expiry,
+                                                        static_cast<SignalObject*>(sender)->_connectionList,
+                                                        static_cast<SignalObject*>(sender)->_summary,
+                                                        static_cast<SignalObject*>(target)->_connectionList,
+                                                        static_cast<SignalObject*>(target)->_slotsBlocked,
+                                                        &controlLink<ParamPack...>);
     }
 
     /**
      *  \fn         disconnect()
      *  \brief      Disconnects a sender's signal from a receiver's slot.
+     *  \note       A concurrent emit that already passed the connection may still call the slot.
      *  \tparam     Sender passes the sender's typename.
      *  \tparam     Receiver passes the receiver's typename.
      *  \tparam     SenderBase passes the signal's implementaion class.
@@ -67,62 +340,756 @@ public:
                            void(ReceiverBase::*slot)(ParamPack...)
     )
     {
-        int iterator = 0;
+        _connections<ParamPack...>.remove(makeKey(sender, signal),
+                                          static_cast<SignalObject*>(receiver),
+                                          Delegate<ParamPack...>(receiver, slot));
+    }
 
-        for (Connection<ParamPack...>* connection : _connections<ParamPack...>)
+    /**
+     *  \fn         disconnect()
+     *  \brief      Disconnects a sender's signal from a receiver's batch slot.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     Receiver passes the receiver's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ReceiveBase passes the slot's implementation class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  receiver passes a pointer to the receiver instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  slot passes a method pointer to the receiver's batch slot.
+     */
+    template<class Sender, class Receiver, class SenderBase, class ReceiverBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isDerived<ReceiverBase, Receiver>
+    static void disconnect(Sender* sender,
+                           Receiver* receiver,
+                           void(SenderBase::*signal)(ParamPack...),
+                           void(ReceiverBase::*slot)(Batch<ParamPack...>)
+    )
+    {
+        _connections<ParamPack...>.remove(makeKey(sender, signal),
+                                          static_cast<SignalObject*>(receiver),
+                                          Delegate<ParamPack...>(receiver, slot));
+    }
+
+    /**
+     *  \fn         disconnect()
+     *  \brief      Disconnects a sender's signal from a receiver's slot bound at compile time.
+     *  \tparam     Slot passes a method pointer to the receiver's slot or batch slot.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     Receiver passes the receiver's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  receiver passes a pointer to the receiver instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     */
+    template<auto Slot, class Sender, class Receiver, class SenderBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isDerived<SignalObject, Receiver> &&
+             std::is_member_function_pointer_v<decltype(Slot)>
+    static void disconnect(Sender* sender, Receiver* receiver, void(SenderBase::*signal)(ParamPack...))
+    {
+        _connections<ParamPack...>.remove(makeKey(sender, signal),
+                                          static_cast<SignalObject*>(receiver),
+                                          Delegate<ParamPack...>::template bind<Slot>(receiver));
+    }
+
+    /**
+     *  \fn         disconnect()
+     *  \brief      Disconnects a sender's signal from a callable bound to a receiver.
+     *  \note       Callables are compared byte by byte, so they must not contain padding, see
+     *              isComparable. Disconnect others via their handle.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     Receiver passes the receiver's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     Function passes the callable's typename.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  receiver passes a pointer to the receiver instance.
+     *  \param[in]  function passes a copy of the connected callable.
+     */
+    template<class Sender, class Receiver, class SenderBase, class Function, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isDerived<SignalObject, Receiver> && isCallable<Function, ParamPack...>
+    static void disconnect(Sender* sender,
+                           void(SenderBase::*signal)(ParamPack...),
+                           Receiver* receiver,
+                           Function&& function
+    )
+    {
+        static_assert(isComparable<Function>, "Callables with padding can only be disconnected via their handle.");
+
+        _connections<ParamPack...>.remove(makeKey(sender, signal),
+                                          static_cast<SignalObject*>(receiver),
+                                          Delegate<ParamPack...>(std::forward<Function>(function)));
+    }
+
+    /**
+     *  \fn         disconnect()
+     *  \brief      Disconnects a sender's signal from a callable.
+     *  \note       Callables are compared byte by byte, so they must not contain padding, see
+     *              isComparable. Disconnect others via their handle.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     Function passes the callable's typename.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  function passes a copy of the connected callable.
+     */
+    template<class Sender, class SenderBase, class Function, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isCallable<Function, ParamPack...>
+    static void disconnect(Sender* sender,
+                           void(SenderBase::*signal)(ParamPack...),
+                           Function&& function
+    )
+    {
+        static_assert(isComparable<Function>, "Callables with padding can only be disconnected via their handle.");
+
+        _connections<ParamPack...>.remove(makeKey(sender, signal),
+                                          nullptr,
+                                          Delegate<ParamPack...>(std::forward<Function>(function)));
+    }
+
+    /**
+     *  \fn         disconnect(const ConnectionHandle<ParamPack...>& handle)
+     *  \brief      Disconnects the connection referenced by a handle in constant time.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  handle passes the handle returned by connect().
+     *  \return     Boolean indicating if the connection existed.
+     */
+    template<class... ParamPack>
+    static bool disconnect(const ConnectionHandle<ParamPack...>& handle)
+    {
+        return _connections<ParamPack...>.remove(handle);
+    }
+
+    /**
+     *  \fn         join(ConnectionGroup& group, const ConnectionHandle<ParamPack...>& handle)
+     *  \brief      Adds the connection referenced by a handle to a group.
+     *  \details    Usage: SignalObject::join(mode, SignalObject::connect(&sensor, &filter, ...));
+     *              The group enables, disables and removes its connections of all signatures
+     *              together. A connection leaves its previous group.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  group passes the group to join.
+     *  \param[in]  handle passes the handle returned by connect() or forward().
+     *  \return     Boolean indicating if the connection exists and the group is valid.
+     */
+    template<class... ParamPack>
+    static bool join(ConnectionGroup& group, const ConnectionHandle<ParamPack...>& handle)
+    {
+        return _connections<ParamPack...>.join(handle, group);
+    }
+
+    /**
+     *  \fn         block(const ConnectionHandle<ParamPack...>& handle)
+     *  \brief      Keeps emits from calling a connection without removing it, in constant time.
+     *  \details    Blocked connections keep their place, priority and remaining shots. Emits skip
+     *              them by the state check they do for every connection anyway.
+     *  \note       Calls already posted to an event queue are not withdrawn.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  handle passes the handle returned by connect() or forward().
+     *  \return     Boolean indicating if the connection existed.
+     */
+    template<class... ParamPack>
+    static bool block(const ConnectionHandle<ParamPack...>& handle)
+    {
+        return _connections<ParamPack...>.block(handle, true);
+    }
+
+    /**
+     *  \fn         unblock(const ConnectionHandle<ParamPack...>& handle)
+     *  \brief      Lets emits call a blocked connection again, in constant time.
+     *  \note       A connection to a receiver blocking its slots stays blocked.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  handle passes the handle returned by connect() or forward().
+     *  \return     Boolean indicating if the connection existed.
+     */
+    template<class... ParamPack>
+    static bool unblock(const ConnectionHandle<ParamPack...>& handle)
+    {
+        return _connections<ParamPack...>.block(handle, false);
+    }
+
+    /**
+     *  \fn         isBlocked(const ConnectionHandle<ParamPack...>& handle)
+     *  \brief      Checks if a connection is blocked by its handle or by its receiver.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  handle passes the handle returned by connect() or forward().
+     *  \return     Boolean indicating result of check, false if the connection doesn't exist.
+     */
+    template<class... ParamPack>
+    static bool isBlocked(const ConnectionHandle<ParamPack...>& handle)
+    {
+        return _connections<ParamPack...>.blocked(handle);
+    }
+
+    /**
+     *  \fn     footprint(void)
+     *  \brief  Reports the memory used by the connections of a signature.
+     *  \details Usage: SignalObject::footprint<int>().bytesInUse; Footprint::collect() reports
+     *          all connected signatures at once.
+     *  \note   The function must be called from the context connecting and disconnecting.
+     *  \tparam ParamPack passes the signature's parameter pack.
+     *  \return Footprint of the signature's pool.
+     */
+    template<class... ParamPack>
+    static SignatureFootprint footprint(void)
+    {
+        return _connections<ParamPack...>.footprint();
+    }
+
+    /**
+     *  \fn         isConnected(const ConnectionHandle<ParamPack...>& handle)
+     *  \brief      Checks if the connection referenced by a handle still exists.
+     *  \note       Expired connections are reported as disconnected.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  handle passes the handle returned by connect().
+     *  \return     Boolean indicating result of check.
+     */
+    template<class... ParamPack>
+    static bool isConnected(const ConnectionHandle<ParamPack...>& handle)
+    {
+        return _connections<ParamPack...>.contains(handle);
+    }
+
+    /**
+     *  \fn         isConnected()
+     *  \brief      Checks if an emit of a sender's signal would reach any runtime connection.
+     *  \details    Emitters may skip building expensive arguments if the check fails. The check
+     *              costs a single load for most unconnected signals. Coroutines awaiting the
+     *              signal count as connections, compile time connections are not considered.
+     *              Signals of a sender blocking its signals are reported as unconnected.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \return     Boolean indicating result of check.
+     */
+    template<class Sender, class SenderBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender>
+    static bool isConnected(Sender* sender, void(SenderBase::*signal)(ParamPack...))
+    {
+        if (!sender)
         {
-            if (connection->isSender(static_cast<SignalObject*>(sender)) &&
-                connection->isReceiver(static_cast<SignalObject*>(receiver)) &&
-                connection->isSignal(static_cast<void(SignalObject::*)(ParamPack...)>(signal)) &&
-                connection->isSlot(static_cast<void(SignalObject::*)(ParamPack...)>(slot))
-            )
-            {
-                delete connection;
-                _connections<ParamPack...>.erase(_connections<ParamPack...>.begin() + iterator);
-            }
-        
-            iterator++;
+            return false;
         }
+
+        return mayBeConnected(sender, signal) &&
+               !static_cast<SignalObject*>(sender)->signalsBlocked() &&
+               _connections<ParamPack...>.connected(makeKey(sender, signal));
     }
 
     /**
      *  \fn         fireAllSlots()
      *  \brief      Calls all connected slots of the specified signal.
+     *  \note       The function takes no locks and never allocates, so it may be called from
+     *              interrupt handlers and other threads.
+     *              Slots running in the modifying context may connect, disconnect and destroy
+     *              senders and receivers. Disconnected slots are not called anymore, slots
+     *              connected during the emit are called from the next emit on.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  args passes the signal's parameter pack, rvalues are moved into the last slot.
+     */
+    template<class Sender, class SenderBase, class... ParamPack, class... Args>
+    requires isDerived<SenderBase, Sender> && (sizeof...(Args) == sizeof...(ParamPack))
+    EMBEDDED_SIGNALS_INLINE static void fireAllSlots(Sender* sender,
+                                                     void(SenderBase::*signal)(ParamPack...),
+                                                     Args&&... args
+    )
+    {
+        if (!sender)
+        {
+            return;
+        }
+
+        trace(sender, signal, args...);
+
+        if (mayBeConnected(sender, signal) && !static_cast<SignalObject*>(sender)->signalsBlocked())
+        {
+            _connections<ParamPack...>.fireAllSlots(makeKey(sender, signal), std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     *  \fn         fireAllSlots()
+     *  \brief      Calls all compile time and runtime connected slots of the specified signal.
+     *  \note       Compile time connections declared by a StaticWiring specialization are
+     *              called directly, runtime connections are only looked up if the wiring
+     *              allows dynamic connections.
+     *  \tparam     Signal passes a method pointer to the sender's signal.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     Args passes the types of the passed arguments.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  args passes the signal's parameter pack.
+     */
+    template<auto Signal, class Sender, class... Args>
+    requires std::is_member_function_pointer_v<decltype(Signal)>
+    static void fireAllSlots(Sender* sender, Args&&... args)
+    {
+        if (!sender || static_cast<SignalObject*>(sender)->signalsBlocked())
+        {
+            return;
+        }
+
+        fireWiredSlots<Signal>(sender, Signal, std::forward<Args>(args)...);
+    }
+
+    /**
+     *  \fn         fireParallel()
+     *  \brief      Calls all connected slots of the specified signal, splitting them across a fan-out pool.
+     *  \details    Slots of receivers that allow parallel slots run concurrently on the pool's
+     *              threads and the emitting thread, after the other slots were called in order.
+     *              The function returns once every slot has finished. fireAllSlots() calls the
+     *              same slots one after another.
+     *  \note       Parallel slots lose their order by priority and must not modify the
+     *              connections. Every slot receives a copy of each value argument.
+     *  \tparam     FanOut passes the typename of the fan-out pool.
      *  \tparam     Sender passes the sender's typename.
      *  \tparam     SenderBase passes the signal's implementaion class.
      *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  fanOut passes the pool executing the parallel slots.
      *  \param[in]  sender passes a pointer to the sender instance.
      *  \param[in]  signal passes a method pointer to the sender's signal.
      *  \param[in]  args passes the signal's parameter pack.
      */
+    template<class FanOut, class Sender, class SenderBase, class... ParamPack, class... Args>
+    requires isDerived<SenderBase, Sender> && (sizeof...(Args) == sizeof...(ParamPack))
+    static void fireParallel(FanOut& fanOut,
+                             Sender* sender,
+                             void(SenderBase::*signal)(ParamPack...),
+                             Args&&... args
+    )
+    {
+        if (!sender)
+        {
+            return;
+        }
+
+        trace(sender, signal, args...);
+
+        if (mayBeConnected(sender, signal) && !static_cast<SignalObject*>(sender)->signalsBlocked())
+        {
+            _connections<ParamPack...>.fireParallel(makeKey(sender, signal), fanOut, std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     *  \fn         fireBatch()
+     *  \brief      Calls all connected slots of the specified signal for a block of argument sets.
+     *  \details    The connections are looked up once per batch and each slot iterates over
+     *              the whole batch, batch slots receive it in a single call.
+     *              Signals with a single parameter take a span of plain values, others a span
+     *              of tuples. Compile time connections are not dispatched.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  batch passes the argument sets.
+     */
+    template<class Sender, class SenderBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender> && isBatchable<ParamPack...>
+    static void fireBatch(Sender* sender,
+                          void(SenderBase::*signal)(ParamPack...),
+                          Batch<ParamPack...> batch
+    )
+    {
+        if (!sender || batch.empty())
+        {
+            return;
+        }
+
+        if (mayBeConnected(sender, signal) && !static_cast<SignalObject*>(sender)->signalsBlocked())
+        {
+            _connections<ParamPack...>.fireBatch(makeKey(sender, signal), batch);
+        }
+    }
+
+    /**
+     *  \fn         awaitSignal()
+     *  \brief      Creates an awaiter suspending a coroutine until the next emit of a signal.
+     *  \details    Usage: auto value = co_await SignalObject::awaitSignal(&sensor, &Sensor::dataReady);
+     *              The coroutine is resumed by the emitting context after all slots were called
+     *              and receives copies of the arguments. Destroying a suspended coroutine removes
+     *              its awaiter, a coroutine waiting on a destroyed sender is never resumed,
+     *              neither is one waiting on a sender calling disconnectAll().
+     *  \note       Awaiting and emitting must happen from the context connecting and disconnecting.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \return     Awaiter of the sender's signal.
+     */
     template<class Sender, class SenderBase, class... ParamPack>
     requires isDerived<SenderBase, Sender>
-    static void fireAllSlots(Sender* sender,
-                             void(SenderBase::*signal)(ParamPack...),
-                             ParamPack... args
+    static SignalAwaiter<ParamPack...> awaitSignal(Sender* sender, void(SenderBase::*signal)(ParamPack...))
+    {
+        return SignalAwaiter<ParamPack...>(_connections<ParamPack...>,
+                                           makeKey(sender, signal),
+                                           sender ? &static_cast<SignalObject*>(sender)->_connectionList : nullptr);
+    }
+
+    /**
+     *  \fn         disconnectAll(void)
+     *  \brief      Removes all connections the object is sender or receiver of.
+     *  \details    Coroutines awaiting the object's signals are unlinked as well.
+     *  \note       The cost is linear in the object's own connections only.
+     *              Calls already posted to an event queue are not withdrawn.
+     *              Nothing is removed while the wiring is frozen.
+     */
+    void disconnectAll(void)
+    {
+        if (Wiring::permits())
+        {
+            removeAll();
+        }
+    }
+
+    /**
+     *  \fn         blockSignals(bool blocked)
+     *  \brief      Mutes or unmutes all signals of the object in constant time.
+     *  \details    Emits of a blocked sender return before the lookup, neither slots, compile
+     *              time connections nor awaiting coroutines are called. Forwarding connections
+     *              into the object's signals are blocked by blockSlots() instead.
+     *  \param[in]  blocked passes whether the object's emits are dropped.
+     */
+    void blockSignals(bool blocked)
+    {
+        _signalsBlocked.store(blocked, std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn         signalsBlocked(void) const
+     *  \brief      Checks if the object's signals are blocked.
+     *  \return     Boolean indicating result of check.
+     */
+    bool signalsBlocked(void) const
+    {
+        return _signalsBlocked.load(std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn         blockSlots(bool blocked)
+     *  \brief      Blocks or unblocks all runtime connections the object is receiver of.
+     *  \details    The connections are flagged like blocked handles, so emits never load the
+     *              receiver. Connections made while the slots are blocked start blocked.
+     *  \note       The cost is linear in the object's own connections only, a connection
+     *              blocked by its handle as well stays blocked.
+     *  \param[in]  blocked passes whether emits skip the object's slots.
+     */
+    void blockSlots(bool blocked)
+    {
+        _slotsBlocked = blocked;
+
+        for (ConnectionList* node = _connectionList.next; node != &_connectionList; node = node->next)
+        {
+            ConnectionLink* link = static_cast<ConnectionLink*>(node);
+            link->handler(link, blocked ? LinkAction::Block : LinkAction::Unblock);
+        }
+    }
+
+    /**
+     *  \fn         slotsBlocked(void) const
+     *  \brief      Checks if the object's slots are blocked.
+     *  \return     Boolean indicating result of check.
+     */
+    bool slotsBlocked(void) const
+    {
+        return _slotsBlocked;
+    }
+
+    /**
+     *  \fn         allowParallelSlots(bool allowed)
+     *  \brief      Declares whether the object's slots may run concurrently to other slots of an emit.
+     *  \details    fireParallel() splits the direct and queued connections of allowing receivers
+     *              across its pool, a slot is still called once per emit.
+     *  \param[in]  allowed passes whether the object's slots are safe to run on pool threads.
+     */
+    void allowParallelSlots(bool allowed)
+    {
+        _parallelSlots.store(allowed, std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn         parallelSlotsAllowed(void) const
+     *  \brief      Checks if the object's slots may run concurrently to other slots of an emit.
+     *  \return     Boolean indicating result of check.
+     */
+    bool parallelSlotsAllowed(void) const
+    {
+        return _parallelSlots.load(std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn         setEventQueue(EventQueueBase* queue)
+     *  \brief      Assigns the queue executing the object's queued slot calls.
+     *  \note       Queued connections capture the queue when they are connected.
+     *  \param[in]  queue passes a pointer to the event queue.
+     */
+    void setEventQueue(EventQueueBase* queue)
+    {
+        _eventQueue = queue;
+    }
+
+    /**
+     *  \fn         eventQueue(void) const
+     *  \brief      Returns the queue executing the object's queued slot calls.
+     *  \return     Pointer to the event queue or nullptr if none is assigned.
+     */
+    EventQueueBase* eventQueue(void) const
+    {
+        return _eventQueue;
+    }
+
+private:
+    friend class SignalTrace;
+
+    /**
+     *  \fn     removeAll(void)
+     *  \brief  Removes all connections the object is sender or receiver of, even if frozen.
+     */
+    void removeAll(void)
+    {
+        while (!_connectionList.empty())
+        {
+            ConnectionLink* link = static_cast<ConnectionLink*>(_connectionList.next);
+            link->handler(link, LinkAction::Remove);
+        }
+    }
+
+    /**
+     *  \fn         insert()
+     *  \brief      Stores a connection of a sender's signal to a callable.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  receiver passes a pointer to the receiver instance or nullptr if there is none.
+     *  \param[in]  slot passes the callable to connect as slot.
+     *  \param[in]  type passes whether the slot is called directly or via the receiver's event queue.
+     *  \param[in]  priority passes the slot's priority.
+     *  \param[in]  expiry passes when the connection removes itself.
+     *  \param[in]  policy passes the policy filtering the emits or nullptr.
+     *  \return     Handle of the connection or an invalid handle if it could not be stored.
+     */
+    template<class Sender, class SenderBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender>
+    static ConnectionHandle<ParamPack...> insert(Sender* sender,
+                                                 void(SenderBase::*signal)(ParamPack...),
+                                                 SignalObject* receiver,
+                                                 const Delegate<ParamPack...>& slot,
+                                                 ConnectionType type,
+                                                 ConnectionPriority priority,
+                                                 ConnectionExpiry expiry,
+                                                 DeliveryPolicy<ParamPack...>* policy
     )
     {
-        for (Connection<ParamPack...>* connection : _connections<ParamPack...>)
+        EventQueueBase* queue = nullptr;
+
+        if (type == ConnectionType::Queued)
         {
-            if (sender &&
-                connection &&
-                connection->isSender(static_cast<SignalObject*>(sender)) &&
-                connection->isSignal(static_cast<void(SignalObject::*)(ParamPack...)>(signal))
+            queue = receiver ? receiver->_eventQueue : nullptr;
+
+            if (!queue ||
+                Connection<ParamPack...>::queuedEventSize() > queue->eventSize() ||
+                (policy && policy->eventSize() > queue->eventSize())
             )
             {
-                connection->fireSlot(args...);
+                return ConnectionHandle<ParamPack...>();
             }
         }
+
+        return _connections<ParamPack...>.insert(makeKey(sender, signal),
+                                                 receiver,
+                                                 Connection<ParamPack...>(slot, queue, policy),
+                                                 priority,
+                                                 expiry,
+                                                 static_cast<SignalObject*>(sender)->_connectionList,
+                                                 static_cast<SignalObject*>(sender)->_summary,
+                                                 receiver ? &receiver->_connectionList : nullptr,
+                                                 receiver && receiver->_slotsBlocked,
+                                                 &controlLink<ParamPack...>);
+    }
+
+    /**
+     *  \fn         controlLink(ConnectionLink* link, LinkAction action)
+     *  \brief      Removes or blocks a connection by one of its links.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \param[in]  link passes a pointer to the connection's link.
+     *  \param[in]  action passes what to apply to the connection.
+     */
+    template<class... ParamPack>
+    static void controlLink(ConnectionLink* link, LinkAction action)
+    {
+        _connections<ParamPack...>.control(link, action);
+    }
+
+    /**
+     *  \fn         fireWiredSlots()
+     *  \brief      Calls all compile time and runtime connected slots of the specified signal.
+     *  \tparam     Signal passes a method pointer to the sender's signal.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's and slot's parameter pack.
+     *  \tparam     Args passes the types of the passed arguments.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  args passes the signal's parameter pack.
+     */
+    template<auto Signal, class Sender, class SenderBase, class... ParamPack, class... Args>
+    requires isDerived<SenderBase, Sender> && (sizeof...(Args) == sizeof...(ParamPack))
+    static void fireWiredSlots(Sender* sender,
+                               void(SenderBase::*signal)(ParamPack...),
+                               Args&&... args
+    )
+    {
+        trace(sender, signal, args...);
+        StaticWiring<Signal>::fireAllSlots(static_cast<SignalObject*>(sender), args...);
+
+        if constexpr (StaticWiring<Signal>::dynamic)
+        {
+            if (mayBeConnected(sender, signal))
+            {
+                _connections<ParamPack...>.fireAllSlots(makeKey(sender, signal), std::forward<Args>(args)...);
+            }
+        }
+    }
+
+    /**
+     *  \fn         trace()
+     *  \brief      Records an emit if the sender has traced signals and isn't blocked.
+     *  \note       The function compiles to nothing unless EMBEDDED_SIGNALS_TRACE is defined.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \tparam     Args passes the types of the passed arguments.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \param[in]  args passes the signal's parameter pack.
+     */
+    template<class Sender, class SenderBase, class... ParamPack, class... Args>
+    EMBEDDED_SIGNALS_INLINE static void trace([[maybe_unused]] Sender* sender,
+                                              [[maybe_unused]] void(SenderBase::*signal)(ParamPack...),
+                                              [[maybe_unused]] const Args&... args
+    )
+    {
+#ifdef EMBEDDED_SIGNALS_TRACE
+        const SignalObject* object = static_cast<SignalObject*>(sender);
+
+        if (object->_traced.load(std::memory_order_relaxed) && !object->signalsBlocked())
+        {
+            SignalTrace::record(makeKey(sender, signal), args...);
+        }
+#endif
+    }
+
+    /**
+     *  \fn         mayBeConnected(Sender* sender, void(SenderBase::*signal)(ParamPack...))
+     *  \brief      Checks the sender's summary and the waiting coroutines before a lookup.
+     *  \note       Callers pass a fresh key to the pool, a stored copy of the key is reloaded
+     *              with a store forwarding stall on every emit.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \return     Boolean indicating that the signal is neither connected nor awaited if false.
+     */
+    template<class Sender, class SenderBase, class... ParamPack>
+    static bool mayBeConnected(Sender* sender, void(SenderBase::*signal)(ParamPack...))
+    {
+        return static_cast<SignalObject*>(sender)->_summary.mayContain(makeKey(sender, signal)) ||
+               _connections<ParamPack...>.waiting();
+    }
+
+    /**
+     *  \fn         makeKey()
+     *  \brief      Creates the index key of a sender's signal.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \return     Key identifying the sender's signal.
+     */
+    template<class Sender, class SenderBase, class... ParamPack>
+    requires isDerived<SenderBase, Sender>
+    static SignalKey<ParamPack...> makeKey(Sender* sender, void(SenderBase::*signal)(ParamPack...))
+    {
+        return SignalKey<ParamPack...>{
+            static_cast<SignalObject*>(sender),
+            static_cast<void(SignalObject::*)(ParamPack...)>(signal)
+        };
     }
 
-private:
     /**
      *  \var    _connections
-     *  \brief  Vector of connections between various signals and slots.
+     *  \brief  Statically allocated connections indexed by sender and signal.
      *  \tparam ParamPack passes the signal's and slot's parameter pack.
      */
     template<class... ParamPack>
-    inline static std::vector<Connection<ParamPack...>*> _connections;
+    inline static ConnectionPool<ParamPack...> _connections;
+
+    /**
+     *  \var    _eventQueue
+     *  \brief  Pointer to the queue executing the object's queued slot calls.
+     */
+    EventQueueBase* _eventQueue = nullptr;
+
+    /**
+     *  \var    _connectionList
+     *  \brief  Sentinel of the list of connections the object is sender or receiver of.
+     */
+    ConnectionList _connectionList;
+
+    /**
+     *  \var    _summary
+     *  \brief  Summary of the object's signals with connections.
+     */
+    SignalSummary _summary;
+
+    /**
+     *  \var    _signalsBlocked
+     *  \brief  Flag dropping the object's emits, read by emits.
+     */
+    std::atomic<bool> _signalsBlocked = false;
+
+    /**
+     *  \var    _slotsBlocked
+     *  \brief  Flag blocking the connections the object is receiver of.
+     */
+    bool _slotsBlocked = false;
+
+    /**
+     *  \var    _parallelSlots
+     *  \brief  Flag allowing the object's slots to run in parallel, read by emits.
+     */
+    std::atomic<bool> _parallelSlots = false;
+
+    /**
+     *  \var    _traced
+     *  \brief  Number of the object's traced signals, read by emits.
+     */
+    std::atomic<std::uint8_t> _traced = 0;
 };
 
+/**
+ *  \fn         SignalTrace::mark(const SignalObject* sender, int change)
+ *  \brief      Updates the number of traced signals of a sender.
+ *  \note       The function is defined here, since it needs the complete SignalObject.
+ *  \param[in]  sender passes a pointer to the sender instance.
+ *  \param[in]  change passes the change of the number.
+ */
+inline void SignalTrace::mark(const SignalObject* sender, int change)
+{
+    const_cast<SignalObject*>(sender)->_traced.fetch_add(static_cast<std::uint8_t>(change), std::memory_order_relaxed);
+}
+
 #endif //SIGNAL_OBJECT_HPP
@@ -0,0 +1,844 @@
+/**
+ *  \file   signalTrace.hpp
+ *  \brief  The file implements recording emits into a binary ring log and replaying them.
+ *  \note   Emits are only recorded if EMBEDDED_SIGNALS_TRACE is defined, replaying works in
+ *          any build.
+ */
+
+#ifndef SIGNAL_TRACE_HPP
+#define SIGNAL_TRACE_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "clock.hpp"
+#include "signalKey.hpp"
+
+#ifndef EMBEDDED_SIGNALS_TRACE_RECORDS
+/**
+ *  \def    EMBEDDED_SIGNALS_TRACE_RECORDS
+ *  \brief  Number of records of the trace ring, which must be a power of two.
+ */
+#define EMBEDDED_SIGNALS_TRACE_RECORDS 64
+#endif
+
+#ifndef EMBEDDED_SIGNALS_TRACE_PAYLOAD
+/**
+ *  \def    EMBEDDED_SIGNALS_TRACE_PAYLOAD
+ *  \brief  Number of bytes a trace record stores of the emitted arguments.
+ */
+#define EMBEDDED_SIGNALS_TRACE_PAYLOAD 16
+#endif
+
+#ifndef EMBEDDED_SIGNALS_TRACE_CHANNELS
+/**
+ *  \def    EMBEDDED_SIGNALS_TRACE_CHANNELS
+ *  \brief  Maximum number of traced signals.
+ */
+#define EMBEDDED_SIGNALS_TRACE_CHANNELS 16
+#endif
+
+class TraceReplay;
+
+/**
+ *  \struct TraceRecord
+ *  \brief  The struct stores a single recorded emit inside the trace ring.
+ *  \note   Inside the ring, the fields besides the sequence are only accessed through relaxed
+ *          std::atomic_ref operations, since saving may run concurrently to recording.
+ */
+struct TraceRecord
+{
+    /**
+     *  \var    sequence
+     *  \brief  Number of the emit plus one once the record is complete, 0 while written.
+     */
+    std::atomic<std::uint32_t> sequence = 0;
+
+    /**
+     *  \var    timestamp
+     *  \brief  Clock tick of the emit.
+     */
+    std::uint32_t timestamp = 0;
+
+    /**
+     *  \var    channel
+     *  \brief  Channel of the emitted signal.
+     */
+    std::uint16_t channel = 0;
+
+    /**
+     *  \var    size
+     *  \brief  Number of argument bytes.
+     */
+    std::uint8_t size = 0;
+
+    /**
+     *  \var    payload
+     *  \brief  Copies of the arguments, packed behind each other.
+     */
+    unsigned char payload[EMBEDDED_SIGNALS_TRACE_PAYLOAD]{};
+};
+
+/**
+ *  \struct TraceChannel
+ *  \brief  The struct links a traced signal to its channel.
+ */
+struct TraceChannel
+{
+    /**
+     *  \var    id
+     *  \brief  Identifier of the sender's signal.
+     */
+    SignalId id{};
+
+    /**
+     *  \var    number
+     *  \brief  Number of the channel.
+     */
+    std::uint16_t number = 0;
+
+    /**
+     *  \var    replay
+     *  \brief  Function emitting the signal with the arguments of a record.
+     */
+    void (*replay)(const SignalId& id, const unsigned char* payload) = nullptr;
+
+    /**
+     *  \var    used
+     *  \brief  Boolean indicating if the channel is attached, read by emits.
+     */
+    std::atomic<bool> used = false;
+};
+
+/**
+ *  \class  SignalTrace
+ *  \brief  The class records the emits of selected signals into a ring of fixed size records.
+ *  \details A signal is traced once it is attached to a channel number, which identifies it in
+ *          the log independent of addresses, so the test build replaying a log attaches the
+ *          same channels to its own instances. Every emit of fireAllSlots() on a traced signal
+ *          stores a record with the clock tick, the channel and a copy of the arguments.
+ *          Recording takes a single atomic increment and a copy of the arguments, overwrites
+ *          the oldest records when the ring is full and never blocks, so it may run in
+ *          interrupt handlers. Objects without traced signals only pay for a flag check.
+ *          save() writes the ring in a portable stream format, which TraceReplay re-emits.
+ *  \note   Channels must be attached and detached by the context connecting and
+ *          disconnecting. Arguments of traced signals must be trivially copyable, which holds
+ *          for references to them as well, and their layout must match between the recording
+ *          target and the replaying build.
+ */
+class SignalTrace
+{
+public:
+    /**
+     *  \var    Records
+     *  \brief  Number of records of the ring.
+     */
+    static constexpr std::size_t Records = EMBEDDED_SIGNALS_TRACE_RECORDS;
+
+    /**
+     *  \var    Payload
+     *  \brief  Number of argument bytes per record.
+     */
+    static constexpr std::size_t Payload = EMBEDDED_SIGNALS_TRACE_PAYLOAD;
+
+    /**
+     *  \var    Channels
+     *  \brief  Maximum number of traced signals.
+     */
+    static constexpr std::size_t Channels = EMBEDDED_SIGNALS_TRACE_CHANNELS;
+
+    /**
+     *  \var    HeaderSize
+     *  \brief  Number of bytes of the stream header.
+     */
+    static constexpr std::size_t HeaderSize = 12;
+
+    /**
+     *  \var    RecordHeaderSize
+     *  \brief  Number of bytes of a record inside the stream besides its arguments.
+     */
+    static constexpr std::size_t RecordHeaderSize = 7;
+
+    /**
+     *  \var    StreamSize
+     *  \brief  Number of bytes save() needs at most.
+     */
+    static constexpr std::size_t StreamSize = HeaderSize + Records * (RecordHeaderSize + Payload);
+
+    static_assert(std::has_single_bit(Records), "The trace records must be a power of two.");
+    static_assert(Payload <= UINT8_MAX, "Invalid trace payload size.");
+    static_assert(Channels <= UINT8_MAX, "The traced signals of a sender are counted in a byte.");
+
+    /**
+     *  \fn         attach(std::uint16_t channel, Sender* sender, void(SenderBase::*signal)(ParamPack...))
+     *  \brief      Traces a sender's signal on a channel.
+     *  \tparam     Sender passes the sender's typename.
+     *  \tparam     SenderBase passes the signal's implementaion class.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  channel passes the number identifying the signal in the log.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  signal passes a method pointer to the sender's signal.
+     *  \return     Boolean indicating if the channel was free and a channel slot was left.
+     */
+    template<class Sender, class SenderBase, class... ParamPack>
+    requires std::is_base_of_v<SenderBase, Sender>
+    static bool attach(std::uint16_t channel, Sender* sender, void(SenderBase::*signal)(ParamPack...))
+    {
+        static_assert((std::is_trivially_copyable_v<std::decay_t<ParamPack>> && ...),
+                      "Traced arguments must be trivially copyable.");
+        static_assert((sizeof(std::decay_t<ParamPack>) + ... + 0) <= Payload,
+                      "The traced arguments exceed EMBEDDED_SIGNALS_TRACE_PAYLOAD.");
+
+        if (!sender || find(channel))
+        {
+            return false;
+        }
+
+        for (TraceChannel& slot : _channels)
+        {
+            if (!slot.used.load(std::memory_order_relaxed))
+            {
+                slot.id = SignalId(SignalKey<ParamPack...>{
+                    static_cast<SignalObject*>(sender),
+                    static_cast<void(SignalObject::*)(ParamPack...)>(signal)
+                });
+                slot.number = channel;
+                slot.replay = &replayAs<ParamPack...>;
+                slot.used.store(true, std::memory_order_release);
+                mark(slot.id.sender, 1);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     *  \fn         detach(std::uint16_t channel)
+     *  \brief      Stops tracing the signal of a channel.
+     *  \param[in]  channel passes the number of the channel.
+     *  \return     Boolean indicating if the channel was attached.
+     */
+    static bool detach(std::uint16_t channel)
+    {
+        TraceChannel* slot = find(channel);
+
+        if (!slot)
+        {
+            return false;
+        }
+
+        release(*slot);
+
+        return true;
+    }
+
+    /**
+     *  \fn     start(void)
+     *  \brief  Starts recording the emits of all traced signals.
+     */
+    static void start(void)
+    {
+        _recording.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn     stop(void)
+     *  \brief  Stops recording, e.g. to freeze the log when a fault is detected.
+     */
+    static void stop(void)
+    {
+        _recording.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn     recording(void)
+     *  \brief  Checks if emits are recorded.
+     *  \return Boolean indicating result of check.
+     */
+    static bool recording(void)
+    {
+        return _recording.load(std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn     clear(void)
+     *  \brief  Discards all records.
+     *  \note   The function must not run concurrently to a recording emit.
+     */
+    static void clear(void)
+    {
+        for (TraceRecord& record : _records)
+        {
+            record.sequence.store(0, std::memory_order_relaxed);
+        }
+
+        _head.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     *  \fn     overwritten(void)
+     *  \brief  Counts the records lost because the ring was full.
+     *  \return Number of overwritten records since the last clear().
+     */
+    static std::uint32_t overwritten(void)
+    {
+        const std::uint32_t head = _head.load(std::memory_order_relaxed);
+
+        return head > Records ? head - static_cast<std::uint32_t>(Records) : 0;
+    }
+
+    /**
+     *  \fn         save(std::span<unsigned char> stream)
+     *  \brief      Writes the records from the oldest to the newest into a stream.
+     *  \details    The stream starts with the magic "ESTR", the format version, the payload
+     *              size and the number of records, followed by each record's tick, channel,
+     *              argument size and arguments. Numbers are stored little endian.
+     *  \note       Records written while saving are skipped, they may be taken by the next save.
+     *  \param[out] stream returns the stream, StreamSize bytes hold the whole ring.
+     *  \return     Number of bytes written, 0 if the stream can't hold the header.
+     */
+    static std::size_t save(std::span<unsigned char> stream)
+    {
+        if (stream.size() < HeaderSize)
+        {
+            return 0;
+        }
+
+        const std::uint32_t head = _head.load(std::memory_order_acquire);
+        std::size_t position = HeaderSize;
+        std::uint32_t count = 0;
+
+        for (std::uint32_t number = head - static_cast<std::uint32_t>(head > Records ? Records : head);
+             number != head;
+             number++
+        )
+        {
+            TraceRecord& slot = _records[number & (Records - 1)];
+            TraceRecord record;
+
+            if (!copy(slot, number + 1, record) ||
+                position + RecordHeaderSize + record.size > stream.size())
+            {
+                continue;
+            }
+
+            put(stream.data() + position, record.timestamp, 4);
+            put(stream.data() + position + 4, record.channel, 2);
+            stream[position + 6] = record.size;
+            std::memcpy(stream.data() + position + RecordHeaderSize, record.payload, record.size);
+
+            position += RecordHeaderSize + record.size;
+            count++;
+        }
+
+        std::memcpy(stream.data(), "ESTR", 4);
+        stream[4] = Version;
+        stream[5] = static_cast<unsigned char>(Payload);
+        put(stream.data() + 6, 0, 2);
+        put(stream.data() + 8, count, 4);
+
+        return position;
+    }
+
+private:
+    friend class SignalObject;
+    friend class TraceReplay;
+
+    /**
+     *  \var    Version
+     *  \brief  Version of the stream format.
+     */
+    static constexpr unsigned char Version = 1;
+
+    /**
+     *  \fn         record(const SignalKey<ParamPack...>& key, const Args&... args)
+     *  \brief      Stores an emit of a signal if it is traced.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \tparam     Args passes the types of the emitted arguments.
+     *  \param[in]  key passes the key of the sender's signal.
+     *  \param[in]  args passes the emitted arguments.
+     */
+    template<class... ParamPack, class... Args>
+    static void record(const SignalKey<ParamPack...>& key, const Args&... args)
+    {
+        if (!_recording.load(std::memory_order_relaxed) || _replaying)
+        {
+            return;
+        }
+
+        const SignalId id(key);
+
+        for (const TraceChannel& channel : _channels)
+        {
+            if (channel.used.load(std::memory_order_acquire) && channel.id == id)
+            {
+                const std::uint32_t number = _head.fetch_add(1, std::memory_order_relaxed);
+                TraceRecord& record = _records[number & (Records - 1)];
+                unsigned char payload[Payload];
+                std::size_t size = 0;
+
+                (pack<std::decay_t<ParamPack>>(payload, size, args), ...);
+
+                record.sequence.store(0, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                std::atomic_ref<std::uint32_t>(record.timestamp).store(EMBEDDED_SIGNALS_CLOCK::now(), std::memory_order_relaxed);
+                std::atomic_ref<std::uint16_t>(record.channel).store(channel.number, std::memory_order_relaxed);
+                std::atomic_ref<std::uint8_t>(record.size).store(static_cast<std::uint8_t>(size), std::memory_order_relaxed);
+                writeBytes(record.payload, payload, size);
+
+                record.sequence.store(number + 1, std::memory_order_release);
+
+                return;
+            }
+        }
+    }
+
+    /**
+     *  \fn         pack(unsigned char* payload, std::size_t& size, const Arg& arg)
+     *  \brief      Appends a copy of an argument to a record's payload.
+     *  \tparam     Value passes the type the signal receives the argument as.
+     *  \tparam     Arg passes the type of the emitted argument.
+     *  \param[in]  payload passes the record's payload.
+     *  \param[in]  size passes and returns the number of bytes used.
+     *  \param[in]  arg passes the argument.
+     */
+    template<class Value, class Arg>
+    static void pack(unsigned char* payload, std::size_t& size, const Arg& arg)
+    {
+        const Value value(arg);
+
+        std::memcpy(payload + size, &value, sizeof(Value));
+        size += sizeof(Value);
+    }
+
+    /**
+     *  \fn         replayAs(const SignalId& id, const unsigned char* payload)
+     *  \brief      Emits a traced signal with the arguments of a record.
+     *  \tparam     ParamPack passes the signal's parameter pack.
+     *  \param[in]  id passes the identifier of the sender's signal.
+     *  \param[in]  payload passes the record's payload.
+     */
+    template<class... ParamPack>
+    static void replayAs(const SignalId& id, const unsigned char* payload)
+    {
+        void(SignalObject::*signal)(ParamPack...);
+        std::tuple<std::decay_t<ParamPack>...> values;
+        std::size_t offset = 0;
+
+        std::memcpy(&signal, id.signal, sizeof(signal));
+        std::apply([payload, &offset](auto&... value)
+                   {
+                       ((std::memcpy(&value, payload + offset, sizeof(value)), offset += sizeof(value)), ...);
+                   },
+                   values);
+        std::apply([&id, signal](auto&... value)
+                   {
+                       (const_cast<SignalObject*>(id.sender)->*signal)(std::forward<ParamPack>(value)...);
+                   },
+                   values);
+    }
+
+    /**
+     *  \fn         copy(TraceRecord& slot, std::uint32_t sequence, TraceRecord& record)
+     *  \brief      Copies a record of the ring if it is complete and not overwritten meanwhile.
+     *  \details    The ring is a sequence lock: recording invalidates the sequence before a
+     *              release fence and the copy rechecks it after an acquire fence, while the
+     *              fields are accessed with relaxed atomics in between.
+     *  \param[in]  slot passes the record inside the ring.
+     *  \param[in]  sequence passes the expected sequence of the record.
+     *  \param[out] record returns the copy.
+     *  \return     Boolean indicating if the copy is consistent.
+     */
+    static bool copy(TraceRecord& slot, std::uint32_t sequence, TraceRecord& record)
+    {
+        if (slot.sequence.load(std::memory_order_acquire) != sequence)
+        {
+            return false;
+        }
+
+        const std::uint8_t size = std::atomic_ref<std::uint8_t>(slot.size).load(std::memory_order_relaxed);
+
+        record.timestamp = std::atomic_ref<std::uint32_t>(slot.timestamp).load(std::memory_order_relaxed);
+        record.channel = std::atomic_ref<std::uint16_t>(slot.channel).load(std::memory_order_relaxed);
+        record.size = size <= Payload ? size : static_cast<std::uint8_t>(Payload);
+        readBytes(record.payload, slot.payload, record.size);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        return slot.sequence.load(std::memory_order_relaxed) == sequence;
+    }
+
+    /**
+     *  \fn         writeBytes(unsigned char* target, const unsigned char* source, std::size_t size)
+     *  \brief      Copies bytes into a record of the ring with relaxed atomic stores.
+     *  \param[out] target passes the record's bytes.
+     *  \param[in]  source passes the bytes to copy.
+     *  \param[in]  size passes the number of bytes.
+     */
+    static void writeBytes(unsigned char* target, const unsigned char* source, std::size_t size)
+    {
+        for (std::size_t index = 0; index < size; index++)
+        {
+            std::atomic_ref<unsigned char>(target[index]).store(source[index], std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  \fn         readBytes(unsigned char* target, unsigned char* source, std::size_t size)
+     *  \brief      Copies bytes out of a record of the ring with relaxed atomic loads.
+     *  \param[out] target returns the copied bytes.
+     *  \param[in]  source passes the record's bytes.
+     *  \param[in]  size passes the number of bytes.
+     */
+    static void readBytes(unsigned char* target, unsigned char* source, std::size_t size)
+    {
+        for (std::size_t index = 0; index < size; index++)
+        {
+            target[index] = std::atomic_ref<unsigned char>(source[index]).load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  \fn         find(std::uint16_t channel)
+     *  \brief      Searches an attached channel.
+     *  \param[in]  channel passes the number of the channel.
+     *  \return     Pointer to the channel or nullptr if it isn't attached.
+     */
+    static TraceChannel* find(std::uint16_t channel)
+    {
+        for (TraceChannel& slot : _channels)
+        {
+            if (slot.used.load(std::memory_order_relaxed) && slot.number == channel)
+            {
+                return &slot;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     *  \fn         release(TraceChannel& slot)
+     *  \brief      Detaches a channel.
+     *  \param[in]  slot passes the channel.
+     */
+    static void release(TraceChannel& slot)
+    {
+        slot.used.store(false, std::memory_order_relaxed);
+        mark(slot.id.sender, -1);
+    }
+
+    /**
+     *  \fn         forget(const SignalObject* sender)
+     *  \brief      Detaches all channels of a destroyed sender.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     */
+    static void forget(const SignalObject* sender)
+    {
+        for (TraceChannel& slot : _channels)
+        {
+            if (slot.used.load(std::memory_order_relaxed) && slot.id.sender == sender)
+            {
+                release(slot);
+            }
+        }
+    }
+
+    /**
+     *  \fn         replay(std::uint16_t channel, const unsigned char* payload)
+     *  \brief      Emits the signal of a channel with the arguments of a record without recording it.
+     *  \param[in]  channel passes the number of the channel.
+     *  \param[in]  payload passes the record's payload.
+     *  \return     Boolean indicating if the channel is attached.
+     */
+    static bool replay(std::uint16_t channel, const unsigned char* payload)
+    {
+        const TraceChannel* slot = find(channel);
+
+        if (!slot)
+        {
+            return false;
+        }
+
+        _replaying = true;
+        slot->replay(slot->id, payload);
+        _replaying = false;
+
+        return true;
+    }
+
+    /**
+     *  \fn         mark(const SignalObject* sender, int change)
+     *  \brief      Updates the number of traced signals of a sender.
+     *  \param[in]  sender passes a pointer to the sender instance.
+     *  \param[in]  change passes the change of the number.
+     */
+    static void mark(const SignalObject* sender, int change);
+
+    /**
+     *  \fn         put(unsigned char* bytes, std::uint32_t value, std::size_t size)
+     *  \brief      Stores a number little endian.
+     *  \param[out] bytes returns the stored bytes.
+     *  \param[in]  value passes the number.
+     *  \param[in]  size passes the number of bytes.
+     */
+    static void put(unsigned char* bytes, std::uint32_t value, std::size_t size)
+    {
+        for (std::size_t index = 0; index < size; index++)
+        {
+            bytes[index] = static_cast<unsigned char>(value >> (8 * index));
+        }
+    }
+
+    /**
+     *  \fn         get(const unsigned char* bytes, std::size_t size)
+     *  \brief      Loads a little endian number.
+     *  \param[in]  bytes passes the stored bytes.
+     *  \param[in]  size passes the number of bytes.
+     *  \return     Loaded number.
+     */
+    static std::uint32_t get(const unsigned char* bytes, std::size_t size)
+    {
+        std::uint32_t value = 0;
+
+        for (std::size_t index = 0; index < size; index++)
+        {
+            value |= static_cast<std::uint32_t>(bytes[index]) << (8 * index);
+        }
+
+        return value;
+    }
+
+    /**
+     *  \var    _records
+     *  \brief  Ring of the recorded emits.
+     */
+    inline static TraceRecord _records[Records]{};
+
+    /**
+     *  \var    _channels
+     *  \brief  Traced signals.
+     */
+    inline static TraceChannel _channels[Channels]{};
+
+    /**
+     *  \var    _head
+     *  \brief  Number of emits recorded since the last clear().
+     */
+    inline static std::atomic<std::uint32_t> _head = 0;
+
+    /**
+     *  \var    _recording
+     *  \brief  Boolean indicating if emits are recorded.
+     */
+    inline static std::atomic<bool> _recording = false;
+
+    /**
+     *  \var    _replaying
+     *  \brief  Boolean indicating if a record is being replayed, which is not recorded again.
+     */
+    inline static bool _replaying = false;
+};
+
+/**
+ *  \class  TraceReplay
+ *  \brief  The class re-emits a stream saved by SignalTrace, e.g. on a host test build.
+ *  \details The replaying build attaches the channels of the stream to its own instances
+ *          first. Records of channels not attached are skipped. Paced replays wait for the
+ *          recorded distance between emits on EMBEDDED_SIGNALS_CLOCK, which reproduces timing
+ *          problems, others replay as fast as possible, e.g. to profile the slots.
+ *  \note   The replay runs in the calling context and keeps a view of the stream.
+ */
+class TraceReplay
+{
+public:
+    /**
+     *  \fn         TraceReplay(std::span<const unsigned char> stream, bool paced)
+     *  \brief      The constructor checks the stream's header.
+     *  \param[in]  stream passes the bytes written by SignalTrace::save().
+     *  \param[in]  paced passes whether the recorded distance between emits is kept.
+     */
+    explicit TraceReplay(std::span<const unsigned char> stream, bool paced = false) :
+            _stream(stream),
+            _paced(paced)
+    {
+        if (stream.size() >= SignalTrace::HeaderSize &&
+            std::memcmp(stream.data(), "ESTR", 4) == 0 &&
+            stream[4] == SignalTrace::Version
+        )
+        {
+            _remaining = SignalTrace::get(stream.data() + 8, 4);
+            _position = SignalTrace::HeaderSize;
+        }
+    }
+
+    /**
+     *  \fn     isValid(void) const
+     *  \brief  Checks if the stream has a valid header.
+     *  \return Boolean indicating result of check.
+     */
+    bool isValid(void) const
+    {
+        return _position != 0;
+    }
+
+    /**
+     *  \fn     remaining(void) const
+     *  \brief  Counts the records left to replay.
+     *  \return Number of records.
+     */
+    std::uint32_t remaining(void) const
+    {
+        return _remaining;
+    }
+
+    /**
+     *  \fn     skipped(void) const
+     *  \brief  Counts the records of channels that are not attached.
+     *  \return Number of records.
+     */
+    std::uint32_t skipped(void) const
+    {
+        return _skipped;
+    }
+
+    /**
+     *  \fn     step(void)
+     *  \brief  Replays the next record.
+     *  \return Boolean indicating if a record was left, false at the end or for a truncated stream.
+     */
+    bool step(void)
+    {
+        if (_remaining == 0 || _position + SignalTrace::RecordHeaderSize > _stream.size())
+        {
+            return false;
+        }
+
+        const unsigned char* bytes = _stream.data() + _position;
+        const std::uint32_t timestamp = SignalTrace::get(bytes, 4);
+        const std::uint16_t channel = static_cast<std::uint16_t>(SignalTrace::get(bytes + 4, 2));
+        const std::size_t size = bytes[6];
+
+        if (size > SignalTrace::Payload || _position + SignalTrace::RecordHeaderSize + size > _stream.size())
+        {
+            return false;
+        }
+
+        unsigned char payload[SignalTrace::Payload]{};
+
+        std::memcpy(payload, bytes + SignalTrace::RecordHeaderSize, size);
+        _position += SignalTrace::RecordHeaderSize + size;
+        _remaining--;
+
+        if (_paced)
+        {
+            pace(timestamp);
+        }
+
+        if (!SignalTrace::replay(channel, payload))
+        {
+            _skipped++;
+        }
+
+        return true;
+    }
+
+    /**
+     *  \fn     run(void)
+     *  \brief  Replays all remaining records.
+     *  \return Number of replayed records.
+     */
+    std::uint32_t run(void)
+    {
+        std::uint32_t count = 0;
+
+        while (step())
+        {
+            count++;
+        }
+
+        return count;
+    }
+
+private:
+    /**
+     *  \fn         pace(std::uint32_t timestamp)
+     *  \brief      Waits until the recorded distance to the first record elapsed.
+     *  \param[in]  timestamp passes the clock tick of the record.
+     */
+    void pace(std::uint32_t timestamp)
+    {
+        const std::uint32_t now = EMBEDDED_SIGNALS_CLOCK::now();
+
+        if (!_started)
+        {
+            _started = true;
+            _origin = timestamp;
+            _start = now;
+
+            return;
+        }
+
+        while (EMBEDDED_SIGNALS_CLOCK::now() - _start < timestamp - _origin);
+    }
+
+    /**
+     *  \var    _stream
+     *  \brief  Bytes of the stream.
+     */
+    std::span<const unsigned char> _stream;
+
+    /**
+     *  \var    _position
+     *  \brief  Offset of the next record, 0 if the stream is invalid.
+     */
+    std::size_t _position = 0;
+
+    /**
+     *  \var    _remaining
+     *  \brief  Number of records left.
+     */
+    std::uint32_t _remaining = 0;
+
+    /**
+     *  \var    _skipped
+     *  \brief  Number of records of channels not attached.
+     */
+    std::uint32_t _skipped = 0;
+
+    /**
+     *  \var    _origin
+     *  \brief  Clock tick of the first replayed record.
+     */
+    std::uint32_t _origin = 0;
+
+    /**
+     *  \var    _start
+     *  \brief  Clock tick the first record was replayed at.
+     */
+    std::uint32_t _start = 0;
+
+    /**
+     *  \var    _paced
+     *  \brief  Boolean indicating if the recorded distances are kept.
+     */
+    bool _paced;
+
+    /**
+     *  \var    _started
+     *  \brief  Boolean indicating if the first record was replayed.
+     */
+    bool _started = false;
+};
+
+#endif //SIGNAL_TRACE_HPP
\ No newline at end of file
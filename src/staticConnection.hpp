@@ -0,0 +1,103 @@
+/**
+ *  \file   staticConnection.hpp
+ *  \brief  The file implements connections wired at compile time.
+ */
+
+#ifndef STATIC_CONNECTION_HPP
+#define STATIC_CONNECTION_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+class SignalObject;
+
+/**
+ *  \class  StaticConnection
+ *  \brief  The class represents a connection between signal and slot fixed at compile time.
+ *  \tparam Sender passes a pointer to the sender instance or nullptr to accept any sender.
+ *  \tparam Receiver passes a pointer to the receiver instance or nullptr for a free function.
+ *  \tparam Slot passes the receiver's method pointer or the free function to call.
+ */
+template<auto Sender, auto Receiver, auto Slot>
+class StaticConnection
+{
+public:
+    /**
+     *  \fn         fireSlot(const SignalObject* sender, Args&... args)
+     *  \brief      Calls the slot if the passed instance is the connection's sender.
+     *  \tparam     Args passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the emitting instance.
+     *  \param[in]  args passes the slot's argument list.
+     */
+    template<class... Args>
+    static void fireSlot([[maybe_unused]] const SignalObject* sender, Args&... args)
+    {
+        if constexpr (!std::is_null_pointer_v<decltype(Sender)>)
+        {
+            if (sender != static_cast<const SignalObject*>(Sender))
+            {
+                return;
+            }
+        }
+
+        if constexpr (std::is_member_function_pointer_v<decltype(Slot)>)
+        {
+            (Receiver->*Slot)(args...);
+        }
+        else
+        {
+            Slot(args...);
+        }
+    }
+};
+
+/**
+ *  \class  StaticConnectionList
+ *  \brief  The class lists the compile time connections of a signal.
+ *  \tparam Dynamic passes whether the signal additionally dispatches to runtime connections.
+ *  \tparam Connections passes the signal's StaticConnection types.
+ */
+template<bool Dynamic, class... Connections>
+class StaticConnectionList
+{
+public:
+    /**
+     *  \var    dynamic
+     *  \brief  Boolean indicating if runtime connections of the signal are dispatched as well.
+     */
+    static constexpr bool dynamic = Dynamic;
+
+    /**
+     *  \var    count
+     *  \brief  Number of compile time connections of the signal.
+     */
+    static constexpr std::size_t count = sizeof...(Connections);
+
+    /**
+     *  \fn         fireAllSlots(const SignalObject* sender, Args&... args)
+     *  \brief      Calls all compile time connected slots of the emitting instance.
+     *  \tparam     Args passes the signal's parameter pack.
+     *  \param[in]  sender passes a pointer to the emitting instance.
+     *  \param[in]  args passes the slots' argument list.
+     */
+    template<class... Args>
+    static void fireAllSlots([[maybe_unused]] const SignalObject* sender, [[maybe_unused]] Args&... args)
+    {
+        (Connections::fireSlot(sender, args...), ...);
+    }
+};
+
+/**
+ *  \struct StaticWiring
+ *  \brief  The struct declares the compile time connections of a signal.
+ *  \note   Specialize the struct for a signal's method pointer to wire it statically, e.g.
+ *          `template<> struct StaticWiring<&Sensor::dataReady> :
+ *              StaticConnectionList<false, StaticConnection<&sensor, &display, &Display::update>> {};`
+ *          Signals without specialization only dispatch to runtime connections.
+ *  \tparam Signal passes the method pointer of the signal.
+ */
+template<auto Signal>
+struct StaticWiring : StaticConnectionList<true>
+{};
+
+#endif //STATIC_CONNECTION_HPP
\ No newline at end of file
@@ -0,0 +1,115 @@
+/**
+ *  \file   wiring.hpp
+ *  \brief  The file implements the lock freezing all connections for real-time operation.
+ */
+
+#ifndef WIRING_HPP
+#define WIRING_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+template<std::size_t Capacity, std::size_t TableSize>
+class ConnectionCore;
+
+class ConnectionGroup;
+class SignalObject;
+
+/**
+ *  \class  Wiring
+ *  \brief  The class locks the connections of all signatures after initialization.
+ *  \details Storage is static, so no emit ever allocates. While the wiring is frozen, connect(),
+ *          forward(), join() and all disconnects fail without touching a pool, so neither the
+ *          signal index nor any connection list changes and the cost of every emit stays
+ *          bounded by the probes of its signal's lookup and the connections it reaches.
+ *          Instrumentation::signals() reports both per signal together with the longest emit
+ *          measured.
+ *          Blocking, unblocking and switching groups stay possible, so operating modes are
+ *          changed without rewiring.
+ *  \note   Destroying a SignalObject or a ConnectionGroup still removes its connections, since
+ *          emits would otherwise call destroyed receivers. Connections expiring while frozen
+ *          stop being called and are reclaimed after thaw().
+ *          The wiring must be frozen and thawed by the context connecting and disconnecting.
+ */
+class Wiring
+{
+public:
+    /**
+     *  \fn     freeze(void)
+     *  \brief  Locks the connections of all signatures.
+     */
+    static void freeze(void)
+    {
+        _frozen = true;
+    }
+
+    /**
+     *  \fn     thaw(void)
+     *  \brief  Allows connecting and disconnecting again.
+     */
+    static void thaw(void)
+    {
+        _frozen = false;
+    }
+
+    /**
+     *  \fn     frozen(void)
+     *  \brief  Checks if the connections are locked.
+     *  \return Boolean indicating result of check.
+     */
+    static bool frozen(void)
+    {
+        return _frozen;
+    }
+
+    /**
+     *  \fn     violations(void)
+     *  \brief  Counts the wiring changes refused while frozen.
+     *  \note   A certified configuration is expected to report zero.
+     *  \return Number of refused changes since the start, saturating at UINT32_MAX.
+     */
+    static std::uint32_t violations(void)
+    {
+        return _violations;
+    }
+
+private:
+    template<std::size_t, std::size_t>
+    friend class ConnectionCore;
+    friend class ConnectionGroup;
+    friend class SignalObject;
+
+    /**
+     *  \fn     permits(void)
+     *  \brief  Checks if the wiring may change and counts a refused change otherwise.
+     *  \return Boolean indicating result of check.
+     */
+    static bool permits(void)
+    {
+        if (!_frozen)
+        {
+            return true;
+        }
+
+        if (_violations != UINT32_MAX)
+        {
+            _violations++;
+        }
+
+        return false;
+    }
+
+    /**
+     *  \var    _frozen
+     *  \brief  Boolean indicating if the connections are locked.
+     */
+    inline static bool _frozen = false;
+
+    /**
+     *  \var    _violations
+     *  \brief  Number of wiring changes refused while frozen.
+     */
+    inline static std::uint32_t _violations = 0;
+};
+
+#endif //WIRING_HPP
\ No newline at end of file
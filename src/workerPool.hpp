@@ -0,0 +1,735 @@
+/**
+ *  \file   workerPool.hpp
+ *  \brief  The file implements a work-stealing thread pool executing queued slot calls.
+ *  \note   The pool requires std::thread and is meant for hosted multi-core targets.
+ */
+
+#ifndef WORKER_POOL_HPP
+#define WORKER_POOL_HPP
+
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "eventQueue.hpp"
+
+#ifndef EMBEDDED_SIGNALS_STRAND_BATCH
+/**
+ *  \def    EMBEDDED_SIGNALS_STRAND_BATCH
+ *  \brief  Maximum number of events a worker executes from a strand before moving on.
+ */
+#define EMBEDDED_SIGNALS_STRAND_BATCH 32
+#endif
+
+class WorkerPoolBase;
+
+/**
+ *  \class  StrandBase
+ *  \brief  The class schedules the events of a queue onto a worker pool one at a time.
+ *  \details A strand is scheduled once when an event is posted to its idle queue and is
+ *          only executed by a single worker at a time, so the events of a strand run in
+ *          order while different strands run in parallel.
+ */
+class StrandBase
+{
+public:
+    StrandBase(const StrandBase&) = delete;
+    StrandBase& operator=(const StrandBase&) = delete;
+
+    /**
+     *  \fn     run(void)
+     *  \brief  Executes pending events and reschedules the strand if events remain.
+     *  \note   The function is called by the worker pool. If the pool is full, the worker
+     *          keeps executing the strand instead of rescheduling it.
+     */
+    void run(void);
+
+protected:
+    /**
+     *  \fn         StrandBase(EventQueueBase& queue, WorkerPoolBase& pool)
+     *  \brief      The constructor initializes an idle strand.
+     *  \param[in]  queue passes the queue holding the strand's events.
+     *  \param[in]  pool passes the pool executing the strand.
+     */
+    StrandBase(EventQueueBase& queue, WorkerPoolBase& pool) :
+            _queue(queue),
+            _pool(pool)
+    {}
+
+    /**
+     *  \fn     ~StrandBase(void)
+     *  \brief  Destroys the strand after its pending events were executed.
+     *  \note   No events must be posted to the strand while it is destroyed.
+     */
+    ~StrandBase(void)
+    {
+        while (_scheduled.load(std::memory_order_seq_cst) || _running.load(std::memory_order_seq_cst) != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     *  \fn         notify(void* context)
+     *  \brief      Schedules a strand after an event was posted to its queue.
+     *  \param[in]  context passes a pointer to the strand.
+     */
+    static void notify(void* context)
+    {
+        static_cast<StrandBase*>(context)->schedule();
+    }
+
+private:
+    /**
+     *  \fn     schedule(void)
+     *  \brief  Submits the strand to the pool unless it is already scheduled.
+     *  \note   If the pool rejects the strand, it stays idle until the next post schedules it.
+     */
+    void schedule(void);
+
+    /**
+     *  \var    _queue
+     *  \brief  Queue holding the strand's events.
+     */
+    EventQueueBase& _queue;
+
+    /**
+     *  \var    _pool
+     *  \brief  Pool executing the strand.
+     */
+    WorkerPoolBase& _pool;
+
+    /**
+     *  \var    _scheduled
+     *  \brief  Boolean indicating if the strand is waiting for or under execution.
+     */
+    std::atomic<bool> _scheduled = false;
+
+    /**
+     *  \var    _running
+     *  \brief  Number of workers currently inside run().
+     */
+    std::atomic<std::uint32_t> _running = 0;
+};
+
+/**
+ *  \class  Strand
+ *  \brief  The class provides an event queue whose events are executed by a worker pool.
+ *  \note   Assign the strand as event queue of one or more receivers, their queued
+ *          connections are then executed in order by the pool's threads.
+ *  \tparam Capacity passes the number of events, which must be a power of two.
+ *  \tparam EventSize passes the number of bytes available to store a single event.
+ *  \tparam Policy passes the queue's overflow policy.
+ */
+template<std::size_t Capacity,
+         std::size_t EventSize = EMBEDDED_SIGNALS_EVENT_SIZE,
+         OverflowPolicy Policy = OverflowPolicy::DropNewest>
+class Strand : public EventQueue<Capacity, EventSize, Policy>, public StrandBase
+{
+public:
+    /**
+     *  \fn         Strand(WorkerPoolBase& pool)
+     *  \brief      The constructor initializes an empty strand.
+     *  \param[in]  pool passes the pool executing the strand.
+     */
+    explicit Strand(WorkerPoolBase& pool) :
+            StrandBase(*this, pool)
+    {
+        this->setNotification(&StrandBase::notify, static_cast<StrandBase*>(this));
+    }
+};
+
+/**
+ *  \class  WorkerPoolBase
+ *  \brief  The class implements a pool of threads executing scheduled strands.
+ *  \details Each worker owns a bounded lock-free Chase-Lev deque of strands. Strands scheduled
+ *          from a worker are pushed to its own deque, which only the worker pushes to and
+ *          pops from. Strands scheduled outside the pool and strands yielding after a batch
+ *          go to a shared lock-free ring. Idle workers take from their own deque, then from
+ *          the shared ring and finally steal the oldest strands of the other workers before
+ *          they go to sleep.
+ *          The storage is provided by the derived WorkerPool class.
+ */
+class WorkerPoolBase
+{
+public:
+    WorkerPoolBase(const WorkerPoolBase&) = delete;
+    WorkerPoolBase& operator=(const WorkerPoolBase&) = delete;
+
+    /**
+     *  \fn         submit(StrandBase* strand, bool yield)
+     *  \brief      Schedules a strand for execution.
+     *  \note       The strand is never executed by the calling thread. If the deques are
+     *              full, the submission is rejected and counted by overflows().
+     *  \param[in]  strand passes a pointer to the strand.
+     *  \param[in]  yield passes whether the strand queues up behind the strands scheduled
+     *              before it instead of being preferred by the calling worker.
+     *  \return     Boolean indicating if the strand was scheduled.
+     */
+    bool submit(StrandBase* strand, bool yield = false)
+    {
+        _pending.fetch_add(1, std::memory_order_seq_cst);
+
+        const bool pushed = _currentPool == this ?
+                            (!yield && _workers[_currentWorker].push(strand, _capacity)) || pushShared(strand) :
+                            pushShared(strand);
+
+        if (!pushed)
+        {
+            _pending.fetch_sub(1, std::memory_order_seq_cst);
+            _overflows.fetch_add(1, std::memory_order_relaxed);
+
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+        }
+        _wakeup.notify_one();
+
+        return true;
+    }
+
+    /**
+     *  \fn     workers(void) const
+     *  \brief  Returns the number of worker threads.
+     *  \return Number of workers.
+     */
+    std::size_t workers(void) const
+    {
+        return _count;
+    }
+
+    /**
+     *  \fn     overflows(void) const
+     *  \brief  Returns the number of submissions rejected because the deques were full.
+     *  \return Number of rejected submissions.
+     */
+    std::size_t overflows(void) const
+    {
+        return _overflows.load(std::memory_order_relaxed);
+    }
+
+protected:
+    /**
+     *  \struct Worker
+     *  \brief  The struct represents a worker thread and its deque of strands.
+     *  \details The deque follows Chase and Lev: the owning worker pushes and pops at the
+     *          bottom, thieves take the oldest strand at the top with a compare-and-swap.
+     */
+    struct Worker
+    {
+        /**
+         *  \fn         push(StrandBase* strand, std::size_t capacity)
+         *  \brief      Appends a strand to the deque.
+         *  \note       The function must only be called by the owning worker.
+         *  \param[in]  strand passes a pointer to the strand.
+         *  \param[in]  capacity passes the capacity of the deque.
+         *  \return     Boolean indicating if the deque had room for the strand.
+         */
+        bool push(StrandBase* strand, std::size_t capacity)
+        {
+            const std::ptrdiff_t end = bottom.load(std::memory_order_relaxed);
+
+            if (end - top.load(std::memory_order_acquire) >= static_cast<std::ptrdiff_t>(capacity))
+            {
+                return false;
+            }
+
+            deque[static_cast<std::size_t>(end) & (capacity - 1)].store(strand, std::memory_order_relaxed);
+            bottom.store(end + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         *  \fn         pop(std::size_t capacity)
+         *  \brief      Takes the newest strand from the deque.
+         *  \note       The function must only be called by the owning worker.
+         *  \param[in]  capacity passes the capacity of the deque.
+         *  \return     Pointer to the strand or nullptr if the deque is empty.
+         */
+        StrandBase* pop(std::size_t capacity)
+        {
+            const std::ptrdiff_t end = bottom.load(std::memory_order_relaxed) - 1;
+
+            bottom.store(end, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            std::ptrdiff_t begin = top.load(std::memory_order_relaxed);
+
+            if (begin > end)
+            {
+                bottom.store(end + 1, std::memory_order_relaxed);
+
+                return nullptr;
+            }
+
+            StrandBase* strand = deque[static_cast<std::size_t>(end) & (capacity - 1)].load(std::memory_order_relaxed);
+
+            if (begin == end)
+            {
+                if (!top.compare_exchange_strong(begin, begin + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    strand = nullptr;
+                }
+
+                bottom.store(end + 1, std::memory_order_relaxed);
+            }
+
+            return strand;
+        }
+
+        /**
+         *  \fn         steal(std::size_t capacity)
+         *  \brief      Takes the oldest strand from the deque of another worker.
+         *  \param[in]  capacity passes the capacity of the deque.
+         *  \return     Pointer to the strand or nullptr if the deque is empty or another
+         *              thread took the strand first.
+         */
+        StrandBase* steal(std::size_t capacity)
+        {
+            std::ptrdiff_t begin = top.load(std::memory_order_acquire);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (begin >= bottom.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+
+            StrandBase* strand = deque[static_cast<std::size_t>(begin) & (capacity - 1)].load(std::memory_order_relaxed);
+
+            return top.compare_exchange_strong(begin, begin + 1, std::memory_order_seq_cst, std::memory_order_relaxed) ?
+                   strand : nullptr;
+        }
+
+        /**
+         *  \var    deque
+         *  \brief  Pointer to the ring buffer of scheduled strands.
+         */
+        std::atomic<StrandBase*>* deque = nullptr;
+
+        /**
+         *  \var    top
+         *  \brief  Position of the oldest strand, advanced by thieves.
+         */
+        std::atomic<std::ptrdiff_t> top = 0;
+
+        /**
+         *  \var    bottom
+         *  \brief  Position behind the newest strand, only written by the owner.
+         */
+        std::atomic<std::ptrdiff_t> bottom = 0;
+
+        /**
+         *  \var    thread
+         *  \brief  Thread executing the worker.
+         */
+        std::thread thread;
+    };
+
+    /**
+     *  \struct SharedSlot
+     *  \brief  The struct stores a strand inside the shared ring.
+     */
+    struct SharedSlot
+    {
+        /**
+         *  \var    sequence
+         *  \brief  Ring position the slot is ready for, which orders producers and workers.
+         */
+        std::atomic<std::size_t> sequence = 0;
+
+        /**
+         *  \var    strand
+         *  \brief  Pointer to the scheduled strand.
+         */
+        StrandBase* strand = nullptr;
+    };
+
+    /**
+     *  \fn         WorkerPoolBase()
+     *  \brief      The constructor initializes the workers inside the passed storage.
+     *  \param[in]  workers passes the array of workers.
+     *  \param[in]  count passes the number of workers.
+     *  \param[in]  deques passes the deque storage of all workers.
+     *  \param[in]  capacity passes the number of strands each deque is able to hold.
+     *  \param[in]  shared passes the storage of the shared ring.
+     *  \param[in]  slots passes the number of strands the shared ring is able to hold.
+     */
+    WorkerPoolBase(Worker* workers,
+                   std::size_t count,
+                   std::atomic<StrandBase*>* deques,
+                   std::size_t capacity,
+                   SharedSlot* shared,
+                   std::size_t slots
+    ) :
+            _workers(workers),
+            _deques(deques),
+            _shared(shared),
+            _count(count),
+            _capacity(capacity),
+            _sharedMask(slots - 1)
+    {}
+
+    /**
+     *  \fn     start(void)
+     *  \brief  Assigns the deques and starts the worker threads.
+     *  \note   The function is called once the derived class constructed the storage.
+     */
+    void start(void)
+    {
+        for (std::size_t index = 0; index <= _sharedMask; index++)
+        {
+            _shared[index].sequence.store(index, std::memory_order_relaxed);
+        }
+
+        for (std::size_t index = 0; index < _count; index++)
+        {
+            _workers[index].deque = _deques + index * _capacity;
+        }
+
+        for (std::size_t index = 0; index < _count; index++)
+        {
+            _workers[index].thread = std::thread(&WorkerPoolBase::work, this, index);
+        }
+    }
+
+    /**
+     *  \fn     stop(void)
+     *  \brief  Executes all scheduled strands and joins the worker threads.
+     */
+    void stop(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _stopping = true;
+        }
+        _wakeup.notify_all();
+
+        for (std::size_t index = 0; index < _count; index++)
+        {
+            _workers[index].thread.join();
+        }
+    }
+
+private:
+    /**
+     *  \fn         pushShared(StrandBase* strand)
+     *  \brief      Appends a strand to the shared ring.
+     *  \param[in]  strand passes a pointer to the strand.
+     *  \return     Boolean indicating if the ring had room for the strand.
+     */
+    bool pushShared(StrandBase* strand)
+    {
+        std::size_t position = _sharedEnqueue.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            SharedSlot& slot = _shared[position & _sharedMask];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (_sharedEnqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.strand = strand;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = _sharedEnqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     *  \fn     popShared(void)
+     *  \brief  Takes the oldest strand from the shared ring.
+     *  \return Pointer to the strand or nullptr if the ring is empty.
+     */
+    StrandBase* popShared(void)
+    {
+        std::size_t position = _sharedDequeue.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            SharedSlot& slot = _shared[position & _sharedMask];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+
+            if (difference == 0)
+            {
+                if (_sharedDequeue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    StrandBase* strand = slot.strand;
+                    slot.sequence.store(position + _sharedMask + 1, std::memory_order_release);
+
+                    return strand;
+                }
+            }
+            else if (difference < 0)
+            {
+                return nullptr;
+            }
+            else
+            {
+                position = _sharedDequeue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     *  \fn         take(std::size_t worker)
+     *  \brief      Takes a strand from the worker's own deque, the shared ring or steals one.
+     *  \param[in]  worker passes the index of the worker.
+     *  \return     Pointer to the strand or nullptr if no strand is scheduled.
+     */
+    StrandBase* take(std::size_t worker)
+    {
+        StrandBase* strand = _workers[worker].pop(_capacity);
+
+        if (!strand)
+        {
+            strand = popShared();
+        }
+
+        for (std::size_t offset = 1; !strand && offset < _count; offset++)
+        {
+            strand = _workers[(worker + offset) % _count].steal(_capacity);
+        }
+
+        if (strand)
+        {
+            _pending.fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+        return strand;
+    }
+
+    /**
+     *  \fn         work(std::size_t worker)
+     *  \brief      Executes scheduled strands until the pool is stopped.
+     *  \param[in]  worker passes the index of the worker.
+     */
+    void work(std::size_t worker)
+    {
+        _currentPool = this;
+        _currentWorker = worker;
+
+        while (true)
+        {
+            if (StrandBase* strand = take(worker))
+            {
+                strand->run();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+
+            _wakeup.wait(lock, [this]{ return _stopping || _pending.load(std::memory_order_seq_cst) != 0; });
+
+            if (_stopping && _pending.load(std::memory_order_seq_cst) == 0)
+            {
+                break;
+            }
+        }
+
+        _currentPool = nullptr;
+    }
+
+    /**
+     *  \var    _currentPool
+     *  \brief  Pool of the worker running on the calling thread or nullptr on other threads.
+     */
+    inline static thread_local const WorkerPoolBase* _currentPool = nullptr;
+
+    /**
+     *  \var    _currentWorker
+     *  \brief  Index of the worker running on the calling thread.
+     */
+    inline static thread_local std::size_t _currentWorker = 0;
+
+    /**
+     *  \var    _workers
+     *  \brief  Pointer to the array of workers.
+     */
+    Worker* _workers;
+
+    /**
+     *  \var    _deques
+     *  \brief  Pointer to the deque storage of all workers.
+     */
+    std::atomic<StrandBase*>* _deques;
+
+    /**
+     *  \var    _shared
+     *  \brief  Pointer to the storage of the shared ring.
+     */
+    SharedSlot* _shared;
+
+    /**
+     *  \var    _count
+     *  \brief  Number of workers.
+     */
+    std::size_t _count;
+
+    /**
+     *  \var    _capacity
+     *  \brief  Number of strands each worker's deque is able to hold.
+     */
+    std::size_t _capacity;
+
+    /**
+     *  \var    _sharedMask
+     *  \brief  Mask wrapping positions of the shared ring to slot indices.
+     */
+    std::size_t _sharedMask;
+
+    /**
+     *  \var    _sharedEnqueue
+     *  \brief  Next position of the shared ring claimed by a producer.
+     */
+    std::atomic<std::size_t> _sharedEnqueue = 0;
+
+    /**
+     *  \var    _sharedDequeue
+     *  \brief  Next position of the shared ring taken by a worker.
+     */
+    std::atomic<std::size_t> _sharedDequeue = 0;
+
+    /**
+     *  \var    _pending
+     *  \brief  Number of scheduled strands not yet taken by a worker.
+     */
+    std::atomic<std::size_t> _pending = 0;
+
+    /**
+     *  \var    _overflows
+     *  \brief  Number of submissions rejected because the deques were full.
+     */
+    std::atomic<std::size_t> _overflows = 0;
+
+    /**
+     *  \var    _sleepMutex
+     *  \brief  Mutex protecting the sleep of idle workers.
+     */
+    std::mutex _sleepMutex;
+
+    /**
+     *  \var    _wakeup
+     *  \brief  Condition waking idle workers.
+     */
+    std::condition_variable _wakeup;
+
+    /**
+     *  \var    _stopping
+     *  \brief  Boolean indicating if the pool is stopping.
+     */
+    bool _stopping = false;
+};
+
+/**
+ *  \class  WorkerPool
+ *  \brief  The class provides the statically sized storage of a worker pool.
+ *  \note   The pool must outlive its strands and all emits posting to them. A strand is
+ *          scheduled at most once at a time and the shared ring holds Workers * Strands
+ *          strands, so submissions never overflow as long as there are not more strands.
+ *  \tparam Workers passes the number of worker threads.
+ *  \tparam Strands passes the number of strands each worker's deque is able to hold, which
+ *          must be a power of two.
+ */
+template<std::size_t Workers, std::size_t Strands = 64>
+class WorkerPool : public WorkerPoolBase
+{
+    static_assert(Workers > 0 && Strands > 0, "Invalid worker pool size.");
+    static_assert(std::has_single_bit(Strands) && std::has_single_bit(Workers * Strands),
+                  "The deque capacity must be a power of two.");
+
+public:
+    /**
+     *  \fn     WorkerPool(void)
+     *  \brief  The constructor starts the worker threads.
+     */
+    WorkerPool(void) :
+            WorkerPoolBase(_storage, Workers, _deques, Strands, _shared, Workers * Strands)
+    {
+        start();
+    }
+
+    /**
+     *  \fn     ~WorkerPool(void)
+     *  \brief  Executes all scheduled strands and stops the worker threads.
+     */
+    ~WorkerPool(void)
+    {
+        stop();
+    }
+
+private:
+    /**
+     *  \var    _storage
+     *  \brief  Workers of the pool.
+     */
+    Worker _storage[Workers];
+
+    /**
+     *  \var    _deques
+     *  \brief  Deque storage of all workers.
+     */
+    std::atomic<StrandBase*> _deques[Workers * Strands]{};
+
+    /**
+     *  \var    _shared
+     *  \brief  Storage of the shared ring.
+     */
+    SharedSlot _shared[Workers * Strands];
+};
+
+inline void StrandBase::run(void)
+{
+    bool submitted = false;
+
+    _running.fetch_add(1, std::memory_order_seq_cst);
+
+    do
+    {
+        _queue.dispatch(EMBEDDED_SIGNALS_STRAND_BATCH);
+    }
+    while (!_queue.empty() && !(submitted = _pool.submit(this, true)));
+
+    if (!submitted)
+    {
+        _scheduled.store(false, std::memory_order_seq_cst);
+
+        if (!_queue.empty())
+        {
+            schedule();
+        }
+    }
+
+    _running.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+inline void StrandBase::schedule(void)
+{
+    if (!_scheduled.exchange(true, std::memory_order_seq_cst) && !_pool.submit(this))
+    {
+        _scheduled.store(false, std::memory_order_seq_cst);
+    }
+}
+
+#endif //WORKER_POOL_HPP
\ No newline at end of file